@@ -1,5 +1,6 @@
 #ifndef ASSEMBLER_DEFINITIONS
 #define ASSEMBLER_DEFINITIONS
+#include <stdio.h>
 #include "Definitions.h"
 
 #define SZ_ERR   0
@@ -24,39 +25,115 @@
 #define GPR_DHSI  6
 #define GPR_DLDX  2
 
+#define IDX_NONE         0
 #define IDX_SOURCE       1  // SI
 #define IDX_DESTINATION  2  // DI
 
-#define BASE_REG 1   // BX
-#define BASE_PTR 2   // BP
+#define BASE_NONE 0
+#define BASE_REG  1  // BX
+#define BASE_PTR  2  // BP
+
+#define DISP_NONE 0  // Displacement classes of an effective address
+#define DISP_BYTE 1
+#define DISP_WORD 2
+
+#define EA_BASES     3
+#define EA_INDEXES   3
+#define DISP_CLASSES 3
+#define ADDRESS_MODE(base, index, disp) ( &AddressModes[(base)][(index)][(disp)] )
 
 #define ACC_BYTE 1   // AL
 #define ACC_WORD 2   // AX
 
 //-------------------------------------------------------
 
-typedef struct{
-    short int  val;
-    SCounter_t size;
-    Boolean_t  isSym;
-}Immediate_t;
+#define OPERAND_NONE 0
+#define OPERAND_REG  1
+#define OPERAND_SREG 2
+#define OPERAND_MEM  3
+#define OPERAND_IMM  4
 
+#define OPERANDS_MAX 2
+#define OPERAND(op, k)  ( ((op)[0].kind == (k)) ? &(op)[0] : &(op)[1] )     // First operand of kind k
+
+/* Operands in source order, the grammar fills them and the size functions
+   and encoders read them through a pointer */
 typedef struct{
-    SCounter_t size;
-    SCounter_t id;
-}Register_t;
+    uint8_t kind;               // OPERAND_*
+    uint8_t size;               // SZ_*
+    uint8_t id;                 // Register or segment register
+    uint8_t mod   : 2;          // Memory operand
+    uint8_t rm    : 3;
+    uint8_t disps : 2;          // Displacement bytes after ModR/M
+    uint8_t isSym : 1;          // Value refers to a label or segment
+    short int val;              // Immediate or displacement
+}Operand_t;
 
 typedef struct{
-    SCounter_t size;
-    Boolean_t  isSym;
     SCounter_t mod;
     SCounter_t rm;
-    short int  disp;
-}Memory_t;
+    SCounter_t disps;       // Displacement bytes after ModR/M
+    SCounter_t clocks;      // 8086 effective address time
+}AddrMode_t;
+
+#define INSN_MAX 8              // Longest instruction is 6 bytes with a segment prefix
+#define INSN_PUT(insn, byte) ( (insn).b[(insn).n++] = (byte) )
+#define INSN_DISP(insn, byte) ( (insn).disp = (insn).n, INSN_PUT(insn, byte) )     // First byte of a field
+#define INSN_IMM(insn, byte)  ( (insn).imm = (insn).n, INSN_PUT(insn, byte) )
+#define INSN_SEG(insn, byte)  ( (insn).seg = (insn).n, INSN_PUT(insn, byte) )
+
+/* A field runs up to the next field or the end, the opcode is never one
+   so 0 is no field. Relocations are placed at the fields */
+typedef struct{
+    uint8_t b[INSN_MAX];
+    uint8_t n;
+    uint8_t disp;               // Displacement or direct address
+    uint8_t imm;                // Immediate, the offset of a far pointer
+    uint8_t seg;                // Segment of a far pointer
+}InsnBytes_t;
+
+/* Definitions for the Encoding Cache */
+
+#define ENCODE_CACHE_BITS 9     // Direct mapped, 512 instructions
+#define ENCODE_CACHE_SIZE (1 << ENCODE_CACHE_BITS)
+
+/* Everything an encoding depends on, operands naming a symbol are never
+   cached. The fields leave no padding so keys compare with memcmp() */
+typedef struct{
+    uint8_t family;             // ENC_*, the encoder
+    uint8_t mode;               // MODE_*
+    uint8_t inst;               // *_INST or the opcode the encoder takes
+    uint8_t sop;                // Overridden segment + 1, 0 if not overridden
+    Operand_t op[OPERANDS_MAX];
+}EncodeKey_t;
+
+typedef struct{
+    EncodeKey_t key;
+    InsnBytes_t insn;
+    Flag_t keepsop;             // The override is still pending after the instruction
+    Boolean_t valid;
+}EncodeEntry_t;
+
+
+/* Definitions for the Instruction IR */
+
+#define IR_INITCAP 4096
+
+/* An instruction pass 1 sized from constant operands. Pass 2 encodes it as
+   it is instead of parsing the line again */
+typedef struct{
+    LCounter_t line;            // Line in the token stream, counted from 0
+    uint8_t family;             // ENC_*, the encoder of the instruction
+    uint8_t mode;
+    uint8_t inst;               // *_INST, 0 for the encoders without one
+    Operand_t op[OPERANDS_MAX];
+}IRRecord_t;
 
 
 /* Definitions for the Symbol Table */
 
+#define SEGMENT_MAX 65536       // A segment is addressed by a 16 bit offset
+
 #define SEGNAMEMAX 120
 #define LABNAMEMAX 120
 #define TYPE_SEGMENT 1
@@ -65,7 +142,8 @@ typedef struct{
 typedef struct{
     char name[SEGNAMEMAX];     // The name of the segment
     LCounter_t loc;            // The location within the source file
-    MCounter_t LC;             // Own location counter of the segment
+    LCounter_t LC;             // Own location counter of the segment
+    LCounter_t size;           // Final size of the segment, known after pass 1
 }Segment_t;
 
 typedef struct{
@@ -79,8 +157,90 @@ typedef struct{
     uint8_t type;               // TYPE_SEGMENT, TYPE_LABEL
     char lname[LABNAMEMAX];     // Label name if type is TYPE_LABEL
     char sname[SEGNAMEMAX];     // Segment name for both types
-    MCounter_t LC;              // Location counter within the current segment of TYPE_LABEL
+    LCounter_t LC;              // Location counter within the current segment of TYPE_LABEL
     LCounter_t loc;             // Global Location Counter for both of the types
 }Symbol_t;
 
+/* Definitions for Relocations */
+
+#define REF_SEGMENT 1           // Base of a segment
+#define REF_OFFSET  2           // Offset within a segment, labels and $
+#define REF_EXTERN  3           // Label defined by another object file
+
+#define LINEREF_MAX 4           // Symbol references within one line
+
+#define FIELD_IMM  0            // Instruction field holding a reference
+#define FIELD_DISP 1
+#define FIELD_SEG  2
+
+typedef struct{
+    uint8_t kind;               // REF_*
+    uint8_t field;              // FIELD_*
+    Boolean_t live;             // Still the value of an operand
+    size_t target;              // Segment index, or external symbol index
+    short int val;              // Value of the operand holding the reference
+}Reference_t;
+
+/* Definitions for the Output Sinks */
+
+#define SINKS_MAX 8             // Files fed by one assembly besides the image
+
+/* A sink receives every byte of the image as it is encoded, in address
+   order, and formats it into its own buffered file. buf is NULL for a run
+   of zeros the image skips, sinks treat it as a gap or as zeros */
+typedef struct Sink{
+    void (*write)(struct Sink *sink, LCounter_t addr, const uint8_t *buf, size_t len);
+    void (*close)(struct Sink *sink);   // Trailer of the file, the file is closed by the output
+    FILE *file;
+    const char *path;
+    void *state;                // Private to the sink
+}Sink_t;
+
+#define HEX_RECORDSIZE 16       // Data bytes per record
+
+typedef struct{
+    uint8_t format;             // FORMAT_IHEX or FORMAT_SREC
+    uint8_t buf[HEX_RECORDSIZE];    // Data of the pending record
+    SCounter_t len;
+    LCounter_t addr;            // Address of buf[0]
+    uint8_t sum;                // Sum of the pending data bytes
+    LCounter_t start;           // Entry address for the termination record
+    LCounter_t count;           // Data records written, for S5
+    LCounter_t upper;           // Intel HEX extended linear address in use
+    SCounter_t addrbytes;       // S-record address width, 2, 3 or 4
+}Records_t;
+
+typedef struct{
+    LCounter_t base;            // Address of the first byte of the image
+    size_t size;                // Size of the image, a trailing gap is sized at close
+    size_t pos;                 // File offset of the next byte
+    size_t end;                 // Largest offset reached, gaps included
+}ImageSink_t;
+
+typedef struct{
+    uint32_t crc;
+    LCounter_t next;            // Address of the next byte, gaps are summed as zeros
+    LCounter_t end;             // Address past the image
+    const char *image;          // Name written next to the checksum
+}Checksum_t;
+
+/* Definitions for the Listing */
+
+#define LISTING_BYTES 8         // Bytes shown per line, the size is always shown
+
+typedef struct{
+    LCounter_t length;          // Bytes emitted by the line
+    uint8_t bytes[LISTING_BYTES];
+}Span_t;
+
+/* Definitions for the MZ Executable */
+
+#define MZ_HEADERSIZE 28        // Fixed part of the header, the relocations follow it
+#define MZ_PARAGRAPH  16        // Segments of an executable start on paragraphs
+
+typedef struct{
+    MCounter_t offset;          // Offset of the word within its segment
+    MCounter_t segment;         // Paragraph of the segment, relative to the load address
+}Fixup_t;
+
 #endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define DEFINITIONS_HEADER
 
 #include <stdint.h>
+#include <stddef.h>
 
 /* Constant Definitions */
 #define SET  1
@@ -12,7 +13,6 @@
 
 /* Limit Definitions */
 #define FILENAMEMAX 255
-#define ERR_BUFFERSIZE 1024
 
 /* Return Values */
 #define RET_SUCCESS 0
@@ -48,9 +48,32 @@ typedef uint32_t LCounter_t;
 typedef uint8_t  Flag_t;
 
 /* Structures */
+#define SCANSET_MAX 4
+
+typedef struct{
+    uint8_t chars[SCANSET_MAX];     // Stop characters of a fast scan, see ScanAccel.c
+}ScanSet_t;
+
+#define LINEBLOCK_SIZE 4096
+
+typedef struct LineBlock{
+    struct LineBlock *next;     // Older block of the same line
+    size_t used;                // Bytes handed out
+    size_t size;                // Capacity of data
+    char data[];
+}LineBlock_t;
+
+typedef struct{
+    char *base;                 // File contents followed by two NUL bytes
+    size_t len;                 // Length of the contents without the NULs
+    size_t maplen;              // Length of the mapping or allocation
+    Boolean_t mapped;           // Mapped by mmap, otherwise read into memory
+}SourceBuffer_t;
+
 typedef struct{
-    String_t name;
-    String_t value;
+    String_t name;              // Interned variable name including '@'
+    String_t value;             // Interned replacement text
+    LCounter_t hash;            // Hash of the name, saves rehashing while growing
 }Variable_t;
 
 #endif
\ No newline at end of file
@@ -57,6 +57,23 @@
 #define RETN_INST  38
 #define RETF_INST  39
 
+/* Encoders, the family of an encoding cache key */
+#define ENC_MOV     1
+#define ENC_ARITH   2
+#define ENC_STACK   3
+#define ENC_IO      4
+#define ENC_XCHG    5
+#define ENC_ADDRESS 6
+#define ENC_SHIFT   7
+#define ENC_INT     8
+#define ENC_RETURN  9
+#define ENC_TEST    10
+#define ENC_ARITH2  11
+#define ENC_INCDEC  12
+#define ENC_JCC     13
+#define ENC_FAROP   14
+#define ENC_NEAROP  15
+
 
 
 #endif
\ No newline at end of file
@@ -1,3 +1,8 @@
+#ifndef ERRORS_HEADER
+#define ERRORS_HEADER
+
+#include "Definitions.h"
+
 #define ERR_SUCCESS      0
 #define ERR_SRCFOVERFLOW 1
 #define ERR_NOSRCFILE    2
@@ -6,22 +11,75 @@
 #define ERR_LABALRDEXST  5
 #define ERR_SRCFNAMEOOB  6
 #define ERR_SYMTABGET    7
+#define ERR_UNKNOWNOPT   8
+#define ERR_OPTOVERFLOW  9
+#define ERR_LSTOVERFLOW  10
+#define ERR_KEYWORDHASH  11
+#define ERR_TOKLISTING   12
+
+/* Diagnostics, kept until the stage exits and printed in line order */
+#define DIAG_ERROR   0
+#define DIAG_WARNING 1              // PrintWarning, the stage goes on
+#define DIAG_NOTE    2
+
+#define DIAGFORMAT_TEXT 0           // Colored text, the default
+#define DIAGFORMAT_JSON 1           // --diagnostics-format=json, one object per line
+
+#define DIAG_INITCAP 256            // Diagnostics, grows by doubling
+#define DIAGPOOL_INITCAP 16384      // Bytes of their text
+
+typedef struct{
+    LCounter_t line;                // 0 if the message names no line
+    LCounter_t key;                 // Sort key, a message without a line stays after the one before it
+    LCounter_t seq;                 // Order of the reports
+    uint8_t severity;               // DIAG_*
+    uint8_t code;                   // ERR_* of InternalError(), ERR_SUCCESS otherwise
+    const char *color;
+    const char *dcolor;             // Color of the detail, NULL for none
+    size_t text;                    // Offset of the printed text in the pool
+    size_t msg;                     // Offset of the message after "Line %d :: "
+    size_t detail;                  // Offset of the detail, 0 for none
+}Diagnostic_t;
 
 #ifdef ERROR_HANDLER
 
-    #include "Definitions.h"
     #define LENERRMSG 100
 
     String_t ErrorMessages[LENERRMSG] = {
         "Success\n",
-        "Only one source file is accepted!\n",
+        "Only one source file is accepted without -f obj!\n",
         "No source file specified!\n",
         "No argument specified!\n",
         "Segment name already exists!\n",
         "Label name already exists!\n",
         "Source file name is out of boundary!\n",
         "Problem while receiving symboltable!\n",
+        "Unknown option!\n",
+        "Too many options!\n",
+        "Only one source file is accepted with -l, -m or --emit!\n",
+        "Keywords share a hash slot, the associated values need updating!\n",
+        "A tokenized source has no text to list with -l!\n",
+        ""
+    };
+
+    // Names of the codes above, the "code" of a JSON diagnostic
+    String_t ErrorNames[LENERRMSG] = {
+        "ERR_SUCCESS",
+        "ERR_SRCFOVERFLOW",
+        "ERR_NOSRCFILE",
+        "ERR_NOARGUMENT",
+        "ERR_SEGALRDEXST",
+        "ERR_LABALRDEXST",
+        "ERR_SRCFNAMEOOB",
+        "ERR_SYMTABGET",
+        "ERR_UNKNOWNOPT",
+        "ERR_OPTOVERFLOW",
+        "ERR_LSTOVERFLOW",
+        "ERR_KEYWORDHASH",
+        "ERR_TOKLISTING",
         ""
-    }
+    };
+
+#endif
 
-#endif
\ No newline at end of file
+#endif
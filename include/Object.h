@@ -0,0 +1,87 @@
+#ifndef OBJECT_DEFINITIONS
+#define OBJECT_DEFINITIONS
+
+#include <stdint.h>
+#include "Definitions.h"
+
+/* Relocatable object files, written by pass 2 with -f obj and read by
+   qasm-link. The file is the image of the sections followed by the tables,
+   every table is an array of the fixed size records below in host order:
+
+       ObjHeader_t | section contents | ObjSection_t[] | ObjSymbol_t[] |
+       ObjReloc_t[] | string table                                        */
+
+#define OBJ_MAGIC     "QOBJ"
+#define OBJ_VERSION   1
+#define OBJ_UNDEFINED 0xFFFF        // Section of a symbol defined by another object
+
+#define OBJ_TABLES(end) ( ((end) + 3) & ~((size_t) 3) )    // Tables follow the image, aligned for reading in place
+
+#define RELOC_OFFSET  1             // Word += placement of the target section within its segment
+#define RELOC_SEGMENT 2             // Word += location of the segment the target section is linked into
+#define RELOC_EXTERN  3             // Word += value of the target symbol
+
+typedef struct{
+    char magic[4];
+    uint16_t version;
+    uint16_t nsections;
+    uint32_t nsymbols;
+    uint32_t nrelocs;
+    uint32_t strsize;               // Bytes in the string table
+    uint32_t tables;                // File offset of the section table
+    uint32_t origin;                // ORG of the source, location of the first section
+}ObjHeader_t;
+
+typedef struct{
+    uint32_t name;                  // Offset in the string table
+    uint32_t size;
+    uint32_t offset;                // File offset of the contents
+}ObjSection_t;
+
+typedef struct{
+    uint32_t name;
+    uint16_t section;               // Index in the section table or OBJ_UNDEFINED
+    uint16_t value;                 // Offset within the section
+}ObjSymbol_t;
+
+typedef struct{
+    uint16_t section;               // Section holding the word
+    uint16_t offset;                // Offset of the word within the section
+    uint8_t  type;                  // RELOC_*
+    uint8_t  reserved;
+    uint16_t reserved2;
+    uint32_t target;                // Section index, a symbol index for RELOC_EXTERN
+}ObjReloc_t;
+
+/* Definitions for the Linker */
+
+typedef struct{
+    const char *path;
+    SourceBuffer_t map;             // Mapped object file
+    ObjHeader_t *hdr;
+    ObjSection_t *sections;
+    ObjSymbol_t *symbols;
+    ObjReloc_t *relocs;
+    char *strings;
+    size_t *segment;                // Linked segment of every section
+    LCounter_t *base;               // Placement of every section within its segment
+    LCounter_t *relstart;           // First relocation of every section, relocations are sorted
+    LCounter_t *value;              // Final value of every symbol
+}Object_t;
+
+typedef struct{
+    const char *name;
+    LCounter_t hash;
+    LCounter_t size;
+    LCounter_t loc;                 // Location in the image
+    LCounter_t parts;               // Sections linked into the segment
+}LinkSegment_t;
+
+typedef struct{
+    const char *name;
+    LCounter_t hash;
+    size_t object;                  // Defining object and symbol
+    size_t symbol;
+}LinkSymbol_t;
+
+#endif
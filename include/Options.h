@@ -0,0 +1,46 @@
+#ifndef OPTIONS_HEADER
+#define OPTIONS_HEADER
+
+#include "Definitions.h"
+
+/* Limit Definitions */
+#define OPTIONS_MAX 32          // Options forwarded from one stage to the next
+#define STREAM_BUFSIZE   65536      // stdio buffer of the inputs in streaming mode
+#define STREAM_FLUSHSIZE 1048576    // Output written back per step in streaming mode
+
+/* Output Formats, -f */
+#define FORMAT_BIN  0           // Flat binary image, the default
+#define FORMAT_IHEX 1           // Intel HEX
+#define FORMAT_SREC 2           // Motorola S-record
+#define FORMAT_MZ   3           // DOS MZ executable with segment relocations
+#define FORMAT_OBJ  4           // Relocatable object for qasm-link
+#define FORMAT_CRC32 5          // CRC-32 of the flat image, --emit only
+#define EMIT_MAX    4           // Additional outputs, --emit
+
+/* Layout Reports, pass 1 prints them and stops */
+#define LAYOUT_NONE    0
+#define LAYOUT_SIZES   1        // --size-only, segments and the image size
+#define LAYOUT_SYMBOLS 2        // --symbols-only, the labels as well
+
+typedef struct{
+    uint8_t format;             // FORMAT_BIN, FORMAT_IHEX, FORMAT_SREC or FORMAT_CRC32
+    char *path;
+}Emit_t;
+
+/* Command line options, decoded by qasm and passed on to every stage */
+typedef struct{
+    Flag_t stream;              // --stream, memory does not grow with the source
+    uint8_t format;             // -f, one of FORMAT_*
+    char *listing;              // -l, listing file or NULL
+    char *mapfile;              // -m, symbol map file or NULL
+    Emit_t emit[EMIT_MAX];      // --emit format=file, written in the same pass
+    SCounter_t emits;
+    uint8_t layout;             // LAYOUT_*
+    Flag_t json;                // --json, the layout report as JSON
+    Flag_t stats;               // --stats, counters of pass 2 on stderr
+    Flag_t tokens;              // --emit-tokens, pass 1 writes the tokenized source
+    LCounter_t maxerrors;       // --max-errors, errors shown by every stage, 0 for all
+    uint8_t diagformat;         // --diagnostics-format, DIAGFORMAT_* of Errors.h
+}Options_t;
+
+#endif
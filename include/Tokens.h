@@ -0,0 +1,74 @@
+#ifndef TOKENS_HEADER
+#define TOKENS_HEADER
+
+#include <stdint.h>
+#include "Definitions.h"
+
+/* Tokenized sources, written by pass 1 with --emit-tokens and read by both
+   passes in place of the preprocessed text. Pass 1 also hands its record
+   to pass 2 in this format through shared memory. The file is
+
+       TokHeader_t | string table | token stream
+
+   The string table holds every distinct string once, NUL terminated. The
+   token stream is a sequence of varints: the token code, then its value
+   for the codes that have one:
+
+       TK_NL                   number of lines it ends, consecutive lines are one token
+       TK_NUMBER               the value, zigzag encoded
+       TK_SEGNAME, TK_LABEL,
+       TK_STRCONST             index in the string table
+       TK_BADCHAR              the character the scanner did not recognize
+
+   Punctuation is its own character, keywords follow TK_KEYWORD in the
+   order of Keywords.def. Codes do not depend on the parser, so one file
+   serves both passes */
+
+#define TOKFILE_MAGIC   "QSMB"
+#define TOKFILE_VERSION 1
+#define TOKFILE_EXT     ".qsmb"
+
+#define TK_END      0
+#define TK_NL       1
+#define TK_NUMBER   2
+#define TK_SEGNAME  3
+#define TK_LABEL    4
+#define TK_STRCONST 5
+#define TK_ORG      6
+#define TK_SEGMENT  7
+#define TK_HERE     8
+#define TK_BADCHAR  9
+#define TK_KEYWORD  128
+#define TOKEN_PUNCT "+-*/!^><()[]:,{}"
+
+enum{
+#define KEYWORD(name, token) KW_##name,
+#include "Keywords.def"
+#undef KEYWORD
+    KEYWORDS
+};
+
+#define TOKEN_CODES (TK_KEYWORD + KEYWORDS)
+#define TOKEN_IDS   1024            // Bound of the token numbers of the parsers
+
+typedef struct{
+    char magic[4];
+    uint16_t version;
+    uint16_t keywords;              // KEYWORDS of the writer
+    uint32_t nstrings;
+    uint32_t strsize;               // Bytes in the string table
+    uint32_t toksize;               // Bytes in the token stream
+}TokHeader_t;
+
+/* Reader of a tokenized source */
+typedef struct{
+    SourceBuffer_t map;
+    char *shm;                      // Record of pass 1 attached instead, or NULL
+    const uint8_t *pos;             // Next token
+    const uint8_t *end;
+    char **strings;                 // Start of every string in the table
+    uint32_t nstrings;
+    LCounter_t lines;               // Newlines left of the current TK_NL
+}TokReader_t;
+
+#endif
@@ -0,0 +1,513 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Assembler.h"
+#include "../../include/Object.h"
+
+#define LINK_BUFSIZE 1048576        // stdio buffer of the image
+
+/* Global Variables */
+Fname_t DstFile;                    // Linked image
+FILE *fdest;
+
+/* Tables */
+Object_t *ObjectTable;              // Objects in command line order
+size_t otsize;
+LinkSegment_t *SegmentTable;        // Segments in order of first appearance
+size_t stsize;
+LinkSymbol_t *SymbolTable;          // Defined symbols
+size_t sytsize;
+LCounter_t *SegHashTable;           // Open addressing, index+1 of the entry or 0
+LCounter_t *SymHashTable;
+LCounter_t SegHashCap;
+LCounter_t SymHashCap;
+
+/* Error Functions/Variables */
+extern uint8_t errcode;
+extern void PrintError(char *color, char *format, ...);
+extern void InternalError(char *format, ...);
+extern void ExternalError(char *format, ...);
+
+/* Source Mapping */
+extern Boolean_t MapSourceFile(const char *path, SourceBuffer_t *src);
+extern void UnmapSourceFile(SourceBuffer_t *src);
+
+/* Linker Function Declerations */
+int main(int argc, char **argv);
+void DecodeArguments(int argc, char **argv);
+void LoadObject(Object_t *obj);
+void PlaceSections(void);
+void DefineSymbols(void);
+void ResolveSymbols(void);
+void WriteImage(void);
+void PrintHelp(void);
+void ExitSafely(int retcode);
+static Boolean_t CheckObject(Object_t *obj);
+static void SortRelocations(Object_t *obj);
+static int CompareRelocations(const void *a, const void *b);
+static LCounter_t HashName(const char *str);
+static LCounter_t GetHashCapacity(size_t entries);
+static size_t FindSegment(const char *name, LCounter_t hash);
+static size_t FindSymbol(const char *name, LCounter_t hash);
+static void *AllocateTable(size_t count, size_t size);
+
+
+
+int main(int argc, char **argv)
+{
+    --argc;
+    ++argv;
+    DecodeArguments(argc, argv);
+
+    size_t idx;
+    for(idx=0; idx<otsize; idx++)
+        LoadObject(&ObjectTable[idx]);
+
+    PlaceSections();                    // Join the sections of equally named segments
+    DefineSymbols();                    // Every label of every object is global
+    ResolveSymbols();                   // Externals of each object
+    WriteImage();                       // Copy and relocate in image order
+
+    ExitSafely(EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
+
+/* Legal arguments: --help, -o image and the object files. The image is
+   named after the first object by default */
+void DecodeArguments(int argc, char **argv)
+{
+    if(argc == 0){
+        errcode = ERR_NOARGUMENT;
+        InternalError("Error: ");
+        exit(EXIT_FAILURE);
+    }
+
+    ObjectTable = AllocateTable(argc, sizeof(Object_t));
+    int idx;
+    for(idx=0; idx<argc; idx++){
+        if(strcmp(argv[idx], "--help") == 0){
+            PrintHelp();
+            exit(EXIT_SUCCESS);
+        }else if(strcmp(argv[idx], "-o") == 0){
+            if( (idx+1 == argc) || (strlen(argv[idx+1]) >= FILENAMEMAX) ){
+                errcode = ERR_SRCFNAMEOOB;
+                InternalError("Error: -o: ");
+                exit(EXIT_FAILURE);
+            }
+            strcpy(DstFile, argv[++idx]);
+        }else if(argv[idx][0] == '-'){
+            errcode = ERR_UNKNOWNOPT;
+            InternalError("Error: %s: ", argv[idx]);
+            exit(EXIT_FAILURE);
+        }else{
+            ObjectTable[otsize++].path = argv[idx];
+        }
+    }
+
+    if(otsize == 0){
+        errcode = ERR_NOSRCFILE;
+        InternalError("Error: ");
+        exit(EXIT_FAILURE);
+    }
+
+    if(DstFile[0] == '\0'){
+        const char *first = ObjectTable[0].path;
+        const char *dot = strrchr(first, '.');
+        size_t len = (dot) ? (size_t)(dot - first) : strlen(first);
+        if(len + 5 > FILENAMEMAX){
+            errcode = ERR_SRCFNAMEOOB;
+            InternalError("Error: ");
+            exit(EXIT_FAILURE);
+        }
+        memcpy(DstFile, first, len);
+        strcpy(DstFile+len, ".bin");
+    }
+}
+
+/* Objects are used in place, nothing is read besides the pages the
+   tables and the sections are on */
+void LoadObject(Object_t *obj)
+{
+    if(MapSourceFile(obj->path, &obj->map) == FALSE){
+        ExternalError("Failed to open %s: ", obj->path);
+        ExitSafely(EXIT_FAILURE);
+    }
+    if(CheckObject(obj) == FALSE){
+        PrintError(COLOR_BOLDRED, "%s is not a valid object file!\n", obj->path);
+        ExitSafely(EXIT_FAILURE);
+    }
+
+    size_t nsec = obj->hdr->nsections;
+    obj->segment  = AllocateTable(nsec, sizeof(size_t));
+    obj->base     = AllocateTable(nsec, sizeof(LCounter_t));
+    obj->relstart = AllocateTable(nsec+1, sizeof(LCounter_t));
+    obj->value    = AllocateTable(obj->hdr->nsymbols, sizeof(LCounter_t));
+
+    SortRelocations(obj);
+}
+
+/* Sections of the same name become one segment, in command line order.
+   Segments are laid out in order of their first appearance from the ORG
+   of the first object */
+void PlaceSections(void)
+{
+    size_t total = 0;
+    size_t idx, sec;
+    for(idx=0; idx<otsize; idx++)
+        total += ObjectTable[idx].hdr->nsections;
+
+    SegmentTable = AllocateTable(total, sizeof(LinkSegment_t));
+    SegHashCap = GetHashCapacity(total);
+    SegHashTable = AllocateTable(SegHashCap, sizeof(LCounter_t));
+
+    for(idx=0; idx<otsize; idx++){
+        Object_t *obj = &ObjectTable[idx];
+        for(sec=0; sec<obj->hdr->nsections; sec++){
+            const char *name = obj->strings + obj->sections[sec].name;
+            LCounter_t hash = HashName(name);
+            size_t seg = FindSegment(name, hash);
+            if(seg == (size_t) -1){
+                LCounter_t slot = hash & (SegHashCap-1);
+                while(SegHashTable[slot] != 0)
+                    slot = (slot+1) & (SegHashCap-1);
+                SegHashTable[slot] = stsize+1;
+                SegmentTable[stsize].name = name;
+                SegmentTable[stsize].hash = hash;
+                seg = stsize++;
+            }
+
+            obj->segment[sec] = seg;
+            obj->base[sec] = SegmentTable[seg].size;
+            SegmentTable[seg].size += obj->sections[sec].size;
+            SegmentTable[seg].parts++;
+            if(SegmentTable[seg].size > SEGMENT_MAX){
+                PrintError(COLOR_BOLDRED, "%s :: Segment %s exceeds 64 KB!\n", obj->path, name);
+                ExitSafely(EXIT_FAILURE);
+            }
+        }
+    }
+
+    LCounter_t loc = ObjectTable[0].hdr->origin;
+    for(idx=0; idx<stsize; idx++){
+        SegmentTable[idx].loc = loc;
+        loc += SegmentTable[idx].size;
+    }
+}
+
+/* A symbol is a label, its value is its offset within the linked segment */
+void DefineSymbols(void)
+{
+    size_t total = 0;
+    size_t idx, sym;
+    for(idx=0; idx<otsize; idx++)
+        total += ObjectTable[idx].hdr->nsymbols;
+
+    SymbolTable = AllocateTable(total, sizeof(LinkSymbol_t));
+    SymHashCap = GetHashCapacity(total);
+    SymHashTable = AllocateTable(SymHashCap, sizeof(LCounter_t));
+
+    Boolean_t erroneous = FALSE;
+    for(idx=0; idx<otsize; idx++){
+        Object_t *obj = &ObjectTable[idx];
+        for(sym=0; sym<obj->hdr->nsymbols; sym++){
+            ObjSymbol_t *osym = &obj->symbols[sym];
+            if(osym->section == OBJ_UNDEFINED)
+                continue;
+
+            const char *name = obj->strings + osym->name;
+            LCounter_t hash = HashName(name);
+            size_t def = FindSymbol(name, hash);
+            if(def != (size_t) -1){
+                PrintError(COLOR_BOLDRED, "%s :: Label %s is already defined by %s!\n",
+                           obj->path, name, ObjectTable[SymbolTable[def].object].path);
+                erroneous = TRUE;
+                continue;
+            }
+
+            LCounter_t slot = hash & (SymHashCap-1);
+            while(SymHashTable[slot] != 0)
+                slot = (slot+1) & (SymHashCap-1);
+            SymHashTable[slot] = sytsize+1;
+            SymbolTable[sytsize].name = name;
+            SymbolTable[sytsize].hash = hash;
+            SymbolTable[sytsize].object = idx;
+            SymbolTable[sytsize].symbol = sym;
+            sytsize++;
+
+            obj->value[sym] = obj->base[osym->section] + osym->value;
+        }
+    }
+
+    if(erroneous == TRUE)
+        ExitSafely(EXIT_FAILURE);
+}
+
+// Every undefined label is reported before giving up
+void ResolveSymbols(void)
+{
+    Boolean_t erroneous = FALSE;
+    size_t idx, sym;
+    for(idx=0; idx<otsize; idx++){
+        Object_t *obj = &ObjectTable[idx];
+        for(sym=0; sym<obj->hdr->nsymbols; sym++){
+            ObjSymbol_t *osym = &obj->symbols[sym];
+            if(osym->section != OBJ_UNDEFINED)
+                continue;
+
+            const char *name = obj->strings + osym->name;
+            size_t def = FindSymbol(name, HashName(name));
+            if(def == (size_t) -1){
+                PrintError(COLOR_BOLDRED, "%s :: Label %s is not defined!\n", obj->path, name);
+                erroneous = TRUE;
+                continue;
+            }
+            obj->value[sym] = ObjectTable[SymbolTable[def].object].value[SymbolTable[def].symbol];
+        }
+    }
+
+    if(erroneous == TRUE)
+        ExitSafely(EXIT_FAILURE);
+}
+
+/* One sequential pass: every segment, every section linked into it in
+   command line order, copied into a buffer, relocated and written */
+void WriteImage(void)
+{
+    fdest = fopen(DstFile, "wb");
+    if(!fdest){
+        ExternalError("Failed to create %s: ", DstFile);
+        ExitSafely(EXIT_FAILURE);
+    }
+    setvbuf(fdest, NULL, _IOFBF, LINK_BUFSIZE);
+
+    uint8_t *buf = AllocateTable(SEGMENT_MAX, sizeof(uint8_t));
+    size_t seg, idx, sec;
+    for(seg=0; seg<stsize; seg++){
+        LCounter_t parts = SegmentTable[seg].parts;
+        for(idx=0; (idx<otsize) && (parts > 0); idx++){
+            Object_t *obj = &ObjectTable[idx];
+            for(sec=0; sec<obj->hdr->nsections; sec++){
+                if(obj->segment[sec] != seg)
+                    continue;
+                parts--;
+
+                ObjSection_t *osec = &obj->sections[sec];
+                memcpy(buf, obj->map.base + osec->offset, osec->size);
+
+                LCounter_t rel;
+                for(rel=obj->relstart[sec]; rel<obj->relstart[sec+1]; rel++){
+                    ObjReloc_t *orel = &obj->relocs[rel];
+                    LCounter_t delta;
+                    if(orel->type == RELOC_OFFSET)
+                        delta = obj->base[orel->target];
+                    else if(orel->type == RELOC_SEGMENT)
+                        delta = SegmentTable[obj->segment[orel->target]].loc;
+                    else
+                        delta = obj->value[orel->target];
+
+                    uint16_t word = buf[orel->offset] | ((uint16_t) buf[orel->offset+1] << 8);
+                    word += delta;
+                    buf[orel->offset]   = (uint8_t) (word & 0x00FF);
+                    buf[orel->offset+1] = (uint8_t) (word >> 8);
+                }
+
+                fwrite(buf, sizeof(uint8_t), osec->size, fdest);
+            }
+        }
+    }
+    free(buf);
+
+    if( (fclose(fdest) != 0) ){
+        fdest = NULL;
+        ExternalError("Failed to write %s: ", DstFile);
+        ExitSafely(EXIT_FAILURE);
+    }
+    fdest = NULL;
+}
+
+void PrintHelp(void)
+{
+    printf("Usage: qasm-link [-o image] file.obj...\n");
+    printf("Options:\n");
+    printf("  --help        Display this message\n");
+    printf("  -o image      Name of the linked image, the first object with .bin by default\n");
+}
+
+void ExitSafely(int retcode)
+{
+    size_t idx;
+    if(fdest){
+        fclose(fdest);
+        fdest = NULL;
+    }
+    if( (retcode == EXIT_FAILURE) && (DstFile[0] != '\0') )
+        unlink(DstFile);            // No partial images
+
+    for(idx=0; idx<otsize; idx++){
+        UnmapSourceFile(&ObjectTable[idx].map);
+        free(ObjectTable[idx].segment);
+        free(ObjectTable[idx].base);
+        free(ObjectTable[idx].relstart);
+        free(ObjectTable[idx].value);
+    }
+    free(ObjectTable);
+    free(SegmentTable);
+    free(SymbolTable);
+    free(SegHashTable);
+    free(SymHashTable);
+
+    exit(retcode);
+}
+
+/* Every table, string, section and relocation must lie inside the file,
+   so the rest of the linker can use them without checking again */
+static Boolean_t CheckObject(Object_t *obj)
+{
+    size_t len = obj->map.len;
+    char *base = obj->map.base;
+
+    if(len < sizeof(ObjHeader_t))
+        return FALSE;
+    obj->hdr = (ObjHeader_t *) base;
+    ObjHeader_t *hdr = obj->hdr;
+    if( (memcmp(hdr->magic, OBJ_MAGIC, 4) != 0) || (hdr->version != OBJ_VERSION) )
+        return FALSE;
+    if( (hdr->tables % 4 != 0) || (hdr->tables > len) )
+        return FALSE;
+
+    size_t need = (size_t) hdr->nsections*sizeof(ObjSection_t) + (size_t) hdr->nsymbols*sizeof(ObjSymbol_t) +
+                  (size_t) hdr->nrelocs*sizeof(ObjReloc_t) + hdr->strsize;
+    if(need > len - hdr->tables)
+        return FALSE;
+
+    obj->sections = (ObjSection_t *) (base + hdr->tables);
+    obj->symbols  = (ObjSymbol_t *) (obj->sections + hdr->nsections);
+    obj->relocs   = (ObjReloc_t *) (obj->symbols + hdr->nsymbols);
+    obj->strings  = (char *) (obj->relocs + hdr->nrelocs);
+    if( (hdr->strsize == 0) || (obj->strings[hdr->strsize-1] != '\0') )
+        return (hdr->nsections == 0) && (hdr->nsymbols == 0);
+
+    size_t idx;
+    for(idx=0; idx<hdr->nsections; idx++){
+        ObjSection_t *sec = &obj->sections[idx];
+        if( (sec->name >= hdr->strsize) || (sec->size > SEGMENT_MAX) ||
+            (sec->offset > hdr->tables) || (sec->size > hdr->tables - sec->offset) )
+            return FALSE;
+    }
+    for(idx=0; idx<hdr->nsymbols; idx++){
+        ObjSymbol_t *sym = &obj->symbols[idx];
+        if( (sym->name >= hdr->strsize) || ((sym->section != OBJ_UNDEFINED) && (sym->section >= hdr->nsections)) )
+            return FALSE;
+    }
+    for(idx=0; idx<hdr->nrelocs; idx++){
+        ObjReloc_t *rel = &obj->relocs[idx];
+        if( (rel->section >= hdr->nsections) || ((LCounter_t) rel->offset + 2 > obj->sections[rel->section].size) )
+            return FALSE;
+        if( (rel->type == RELOC_OFFSET) || (rel->type == RELOC_SEGMENT) ){
+            if(rel->target >= hdr->nsections)
+                return FALSE;
+        }else if(rel->type == RELOC_EXTERN){
+            if(rel->target >= hdr->nsymbols)
+                return FALSE;
+        }else
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+/* Pass 2 writes the relocations in section order already, sorting is only
+   needed for reopened segments. relstart then splits them by section */
+static void SortRelocations(Object_t *obj)
+{
+    size_t nrel = obj->hdr->nrelocs;
+    size_t idx;
+    for(idx=1; idx<nrel; idx++){
+        if(CompareRelocations(&obj->relocs[idx-1], &obj->relocs[idx]) > 0){
+            qsort(obj->relocs, nrel, sizeof(ObjReloc_t), CompareRelocations);
+            break;
+        }
+    }
+
+    size_t sec = 0;
+    for(idx=0; idx<nrel; idx++)
+        while(sec <= obj->relocs[idx].section)
+            obj->relstart[sec++] = idx;
+    while(sec <= obj->hdr->nsections)
+        obj->relstart[sec++] = nrel;
+}
+
+static int CompareRelocations(const void *a, const void *b)
+{
+    const ObjReloc_t *ra = a, *rb = b;
+    if(ra->section != rb->section)
+        return (ra->section < rb->section) ? -1 : 1;
+    if(ra->offset != rb->offset)
+        return (ra->offset < rb->offset) ? -1 : 1;
+    return 0;
+}
+
+/* FNV-1a, as the preprocessor hashes its variables */
+static LCounter_t HashName(const char *str)
+{
+    LCounter_t hash = 2166136261u;
+    while(*str){
+        hash ^= (uint8_t) *str++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Twice the entries rounded to a power of two, the load factor stays below 1/2
+static LCounter_t GetHashCapacity(size_t entries)
+{
+    LCounter_t cap = 16;
+    while(cap < entries*2)
+        cap <<= 1;
+    return cap;
+}
+
+static size_t FindSegment(const char *name, LCounter_t hash)
+{
+    LCounter_t slot = hash & (SegHashCap-1);
+    while(SegHashTable[slot] != 0){
+        LinkSegment_t *seg = &SegmentTable[SegHashTable[slot]-1];
+        if( (seg->hash == hash) && (strcmp(seg->name, name) == 0) )
+            return SegHashTable[slot]-1;
+        slot = (slot+1) & (SegHashCap-1);
+    }
+    return -1;
+}
+
+static size_t FindSymbol(const char *name, LCounter_t hash)
+{
+    LCounter_t slot = hash & (SymHashCap-1);
+    while(SymHashTable[slot] != 0){
+        LinkSymbol_t *sym = &SymbolTable[SymHashTable[slot]-1];
+        if( (sym->hash == hash) && (strcmp(sym->name, name) == 0) )
+            return SymHashTable[slot]-1;
+        slot = (slot+1) & (SymHashCap-1);
+    }
+    return -1;
+}
+
+// Zeroed table, the linker can not continue without it
+static void *AllocateTable(size_t count, size_t size)
+{
+    void *table = calloc( (count > 0) ? count : 1, size );
+    if(!table){
+        ExternalError("Failed to allocate linker tables: ");
+        ExitSafely(EXIT_FAILURE);
+    }
+    return table;
+}
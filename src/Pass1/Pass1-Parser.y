@@ -21,37 +21,44 @@ extern Flag_t isSOP;                     // Is segment is overwritten
 extern Flag_t isORG;                     // Is ORG directive used
 extern uint8_t SOP;
 extern LCounter_t LN;
-extern MCounter_t LC;
+extern LCounter_t LC;
 
 /* Tables */
 extern Segment_t *SegmentTable;
 extern Label_t *LabelTable;
 extern size_t ltsize;
 extern size_t stsize;
+extern LCounter_t SegmentRefs;           // Segment references, one relocation each at most
 
 extern SCounter_t CalculateSize(short int val);
+extern const AddrMode_t AddressModes[EA_BASES][EA_INDEXES][DISP_CLASSES];
 extern Boolean_t CheckSignExtension(short int val);
 extern short int ComputeFactorial(short int number);
 extern Boolean_t RegisterLabel(char *str);
+extern long int GetIncbinSize(char *path, long int offset, long int length);
 extern void ExitSafely(int retcode);
 
 /* Functions */
-extern SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm, uint8_t sreg); // MOV
-extern SCounter_t GetStackBlockSize(uint8_t mode, uint8_t inst, Register_t reg, uint8_t sreg, Memory_t mem);              // POP, PUSH
-extern SCounter_t GetXchgBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem);                         // XCHG
-extern SCounter_t GetIOBlockSize(uint8_t mode, Register_t reg, Immediate_t imm);                                          // INB, INW, OUTB, OUTW
-extern SCounter_t GetAddressBlockSize(uint8_t inst, Register_t reg, Memory_t mem);                                                      // LEA, LES, LDS
-extern SCounter_t GetArithmeticBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm);  // ADC, ADD, AND, CMP, OR, SBB, SUB, XOR
-extern SCounter_t GetShiftRotateBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem);                  // RCL, RCR, ROL, ROR, SAL, SAR, SHL, SHR
-extern SCounter_t GetIncDecBlockSize(uint8_t mode, Register_t reg, Memory_t mem);                                         // INC, DEC
-extern SCounter_t GetArithmetic2Size(uint8_t mode, Register_t reg, Memory_t mem);                                         // DIV, IDIV, MUL, IMUL, NEG, NOT
-extern SCounter_t GetReturnBlockSize(uint8_t mode, Immediate_t imm);                                                      // RETN, RETF
-extern SCounter_t GetTestSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm);             // TEST
-extern SCounter_t GetFarOpSize(uint8_t mode, Memory_t mem, Immediate_t imm1, Immediate_t imm2);                           // JMPF, CALLF
-extern SCounter_t GetNearOpSize(uint8_t mode, Register_t reg, Memory_t mem, Immediate_t imm);                             // JMPN, CALLN
-extern SCounter_t GetInterruptSize(Immediate_t imm);                                                                      // INT
+extern SCounter_t GetMovBlockSize(uint8_t mode, const Operand_t *op);                                                           // MOV
+extern SCounter_t GetStackBlockSize(uint8_t mode, uint8_t inst, const Operand_t *op);                                     // POP, PUSH
+extern SCounter_t GetXchgBlockSize(uint8_t mode, const Operand_t *op);                                                    // XCHG
+extern SCounter_t GetIOBlockSize(uint8_t mode, const Operand_t *op);                                                      // INB, INW, OUTB, OUTW
+extern SCounter_t GetAddressBlockSize(uint8_t inst, const Operand_t *op);                                                               // LEA, LES, LDS
+extern SCounter_t GetArithmeticBlockSize(uint8_t mode, const Operand_t *op);                                              // ADC, ADD, AND, CMP, OR, SBB, SUB, XOR
+extern SCounter_t GetShiftRotateBlockSize(uint8_t mode, const Operand_t *op);                                             // RCL, RCR, ROL, ROR, SAL, SAR, SHL, SHR
+extern SCounter_t GetIncDecBlockSize(uint8_t mode, const Operand_t *op);                                                  // INC, DEC
+extern SCounter_t GetArithmetic2Size(uint8_t mode, const Operand_t *op);                                                  // DIV, IDIV, MUL, IMUL, NEG, NOT
+extern SCounter_t GetReturnBlockSize(uint8_t mode, const Operand_t *op);                                                  // RETN, RETF
+extern SCounter_t GetTestSize(uint8_t mode, const Operand_t *op);                                                         // TEST
+extern SCounter_t GetFarOpSize(uint8_t mode, const Operand_t *op);                                                        // JMPF, CALLF
+extern SCounter_t GetNearOpSize(uint8_t mode, const Operand_t *op);                                                       // JMPN, CALLN
+extern SCounter_t GetInterruptSize(const Operand_t *op);                                                                  // INT
 extern SCounter_t GetEscapeBlockSize(void);                                                                               // ESC0-7
 
+/* Instruction IR */
+extern void RecordIR(uint8_t family, uint8_t mode, uint8_t inst, const Operand_t *op);  // Pass 2 encodes it without parsing
+extern void DropIR(void);                                                               // No records after a syntax error
+
 
 /* Error Variables */
 extern Boolean_t erroneous;
@@ -71,6 +78,7 @@ extern int yylex();
     struct{
         short int val;
         uint8_t   isSym;
+        long int  wide;     // Unchecked value of a NUMBER token
     }imm_t;
 
     struct{
@@ -83,10 +91,18 @@ extern int yylex();
         uint8_t isSym;
         uint8_t mod;
         uint8_t rm;
+        uint8_t disps;      // Displacement bytes after ModR/M
         short int disp;
     }mem_t;
 
     int   ival;     // Decimal Values
+    long int lval;  // Repeat Counts
+
+    struct{
+        char *path;
+        long int offset;
+        long int length;    // -1 up to the end of the file
+    }bin_t;
     char *sval;     // String  Values
     size_t szval;
 }
@@ -120,7 +136,7 @@ extern int yylex();
 %token REG_CL      REG_CX       REG_DH       REG_DI       REG_DL       REG_DX       REG_SI       REG_SP
 %token SREG_CS     SREG_DS      SREG_ES      SREG_SS
 %token SIZE_BYTE   SIZE_DWORD   SIZE_WORD
-%token DIR_PUT     DIR_TIMES    DIR_ORG      DIR_SEGMENT  DIR_HERE
+%token DIR_PUT     DIR_TIMES    DIR_ORG      DIR_SEGMENT  DIR_HERE     DIR_INCBIN
 %token NL
 
 %token <sval> LABEL
@@ -151,7 +167,13 @@ init: %empty
                                                     }
                                                     LN++; 
                                                 }
-    | init DIR_SEGMENT SEGNAME '{' init '}'     { LC += SegmentTable[stsize-1].LC; }
+    | init DIR_SEGMENT SEGNAME '{' init '}'     {
+                                                    if(SegmentTable[stsize-1].LC > SEGMENT_MAX){
+                                                        PrintError(COLOR_BOLDRED, "Line %d :: Segment %s exceeds 64 KB!\n", LN, SegmentTable[stsize-1].name);
+                                                        erroneous = TRUE;
+                                                    }
+                                                    LC += SegmentTable[stsize-1].LC;
+                                                }
     | init LABEL ':' NL                         { 
                                                     Boolean_t retval = RegisterLabel($<sval>2);
                                                     if(retval == FALSE)
@@ -161,7 +183,35 @@ init: %empty
 ;
 
 asmdir: DIR_PUT series                          { SegmentTable[stsize-1].LC += $<szval>2; }
-      | DIR_TIMES number DIR_PUT series         { SegmentTable[stsize-1].LC += $<imm_t.val>2 * $<szval>4;  }
+      | DIR_TIMES count DIR_PUT series          {
+                                                    long int count = $<lval>2;
+                                                    if( (count < 0) || (count * $<szval>4 > SEGMENT_MAX) ){
+                                                        PrintError(COLOR_BOLDRED, "Line %d :: TIMES count does not fit into the segment!\n", LN);
+                                                        erroneous = TRUE;
+                                                    }else
+                                                        SegmentTable[stsize-1].LC += count * $<szval>4;
+                                                }
+      | incbin                                  {
+                                                    long int size = GetIncbinSize($<bin_t.path>1, $<bin_t.offset>1, $<bin_t.length>1);
+                                                    if(size < 0)
+                                                        erroneous = TRUE;
+                                                    else
+                                                        SegmentTable[stsize-1].LC += size;
+                                                }
+;
+
+/* INCBIN "file" [, offset [, length]] */
+incbin: DIR_INCBIN STRCONST                     { $<bin_t.path>$ = $<sval>2; $<bin_t.offset>$ = 0;           $<bin_t.length>$ = -1; }
+      | DIR_INCBIN STRCONST ',' count           { $<bin_t.path>$ = $<sval>2; $<bin_t.offset>$ = $<lval>4;    $<bin_t.length>$ = -1; }
+      | DIR_INCBIN STRCONST ',' count ',' count {
+                                                    $<bin_t.path>$ = $<sval>2; $<bin_t.offset>$ = $<lval>4;
+                                                    $<bin_t.length>$ = $<lval>6;
+                                                    if($<lval>6 < 0){
+                                                        PrintError(COLOR_BOLDRED, "Line %d :: INCBIN length is negative!\n", LN);
+                                                        erroneous = TRUE;
+                                                        $<bin_t.length>$ = 0;
+                                                    }
+                                                }
 ;
 
 series: number              { $<szval>$ = CalculateSize($<imm_t.val>1); }
@@ -183,292 +233,320 @@ asminst: INST_SEG sreg                      {
 ;
 
 data_transfer: INST_MOV   reg  ',' reg      {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg = 0;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                 
-                                                SCounter_t ret = GetMovBlockSize(MODE_REG_REG, regd, regs, mem, imm, sreg);
+                                                SCounter_t ret = GetMovBlockSize(MODE_REG_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_MOV, MODE_REG_REG, 0, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_MOV   reg  ',' mem      {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg = 0;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
 
-                                                SCounter_t ret = GetMovBlockSize(MODE_REG_MEM, regd, regs, mem, imm, sreg);
+                                                SCounter_t ret = GetMovBlockSize(MODE_REG_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_MOV, MODE_REG_MEM, 0, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_MOV   mem  ',' reg      {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg = 0;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                 
-                                                SCounter_t ret = GetMovBlockSize(MODE_MEM_REG, regd, regs, mem, imm, sreg);
+                                                SCounter_t ret = GetMovBlockSize(MODE_MEM_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_MOV, MODE_MEM_REG, 0, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_MOV   reg  ',' number   {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg = 0;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                SCounter_t ret = GetMovBlockSize(MODE_REG_IMM, regd, regs, mem, imm, sreg);
+                                                SCounter_t ret = GetMovBlockSize(MODE_REG_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_MOV, MODE_REG_IMM, 0, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_MOV   mem  ',' number   {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg = 0;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                SCounter_t ret = GetMovBlockSize(MODE_MEM_IMM, regd, regs, mem, imm, sreg);
+                                                SCounter_t ret = GetMovBlockSize(MODE_MEM_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_MOV, MODE_MEM_IMM, 0, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_MOV   sreg ',' reg      {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg;
-                                                sreg = $<ival>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_SREG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<ival>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                SCounter_t ret = GetMovBlockSize(MODE_SREG_REG, regd, regs, mem, imm, sreg);
+                                                SCounter_t ret = GetMovBlockSize(MODE_SREG_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_MOV, MODE_SREG_REG, 0, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_MOV   sreg ',' mem      {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg;
-                                                sreg = $<ival>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_SREG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<ival>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
 
-                                                SCounter_t ret = GetMovBlockSize(MODE_SREG_MEM, regd, regs, mem, imm, sreg);
+                                                SCounter_t ret = GetMovBlockSize(MODE_SREG_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_MOV, MODE_SREG_MEM, 0, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_MOV   reg  ',' sreg     {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg;
-                                                sreg = $<ival>4;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_SREG } };
+                                                op[1].id = $<ival>4;
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetMovBlockSize(MODE_REG_SREG, regd, regs, mem, imm, sreg);
+                                                SCounter_t ret = GetMovBlockSize(MODE_REG_SREG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_MOV, MODE_REG_SREG, 0, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_MOV   mem  ',' sreg     {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg;
-                                                sreg = $<ival>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_SREG } };
+                                                op[1].id = $<ival>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                SCounter_t ret = GetMovBlockSize(MODE_MEM_SREG, regd, regs, mem, imm, sreg);
+                                                SCounter_t ret = GetMovBlockSize(MODE_MEM_SREG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_MOV, MODE_MEM_SREG, 0, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
              | INST_PUSH  reg               {
-                                                Register_t reg; Memory_t mem; uint8_t sreg=0;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetStackBlockSize(MODE_REG, PUSH_INST, reg, sreg, mem);
+                                                SCounter_t ret = GetStackBlockSize(MODE_REG, PUSH_INST, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_STACK, MODE_REG, PUSH_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_PUSH  sreg              {
-                                                Register_t reg; Memory_t mem; uint8_t sreg;
-                                                sreg = $<ival>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_SREG } };
+                                                op[0].id = $<ival>2;
 
-                                                SCounter_t ret = GetStackBlockSize(MODE_SREG, PUSH_INST, reg, sreg, mem);
+                                                SCounter_t ret = GetStackBlockSize(MODE_SREG, PUSH_INST, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_STACK, MODE_SREG, PUSH_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_PUSH  mem               {
-                                                Register_t reg; Memory_t mem; uint8_t sreg = 0;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                SCounter_t ret = GetStackBlockSize(MODE_MEM, PUSH_INST, reg, sreg, mem);
+                                                SCounter_t ret = GetStackBlockSize(MODE_MEM, PUSH_INST, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_STACK, MODE_MEM, PUSH_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
              | INST_POP   reg               {
-                                                Register_t reg; Memory_t mem; uint8_t sreg=0;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetStackBlockSize(MODE_REG, POP_INST, reg, sreg, mem);
+                                                SCounter_t ret = GetStackBlockSize(MODE_REG, POP_INST, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_STACK, MODE_REG, POP_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_POP   sreg              {
-                                                Register_t reg; Memory_t mem; uint8_t sreg;
-                                                sreg = $<ival>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_SREG } };
+                                                op[0].id = $<ival>2;
 
-                                                SCounter_t ret = GetStackBlockSize(MODE_SREG, POP_INST, reg, sreg, mem);
+                                                SCounter_t ret = GetStackBlockSize(MODE_SREG, POP_INST, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_STACK, MODE_SREG, POP_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_POP   mem               {
-                                                Register_t reg; Memory_t mem; uint8_t sreg = 0;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                SCounter_t ret = GetStackBlockSize(MODE_MEM, POP_INST, reg, sreg, mem);
+                                                SCounter_t ret = GetStackBlockSize(MODE_MEM, POP_INST, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_STACK, MODE_MEM, POP_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
              | INST_XCHG  reg ',' reg       {
-                                                Register_t regd, regs; Memory_t mem;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                SCounter_t ret = GetXchgBlockSize(MODE_REG_REG, regd, regs, mem);
+                                                SCounter_t ret = GetXchgBlockSize(MODE_REG_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_XCHG, MODE_REG_REG, 0, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_XCHG  mem ',' reg       {
-                                                Register_t regd, regs; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                 
-                                                SCounter_t ret = GetXchgBlockSize(MODE_MEM_REG, regd, regs, mem);
+                                                SCounter_t ret = GetXchgBlockSize(MODE_MEM_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_XCHG, MODE_MEM_REG, 0, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
              | INST_XLAT                    { SegmentTable[stsize-1].LC += 1; }
 
              | INST_INB   number            {
-                                                Register_t reg; Immediate_t imm;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                 uint8_t sz = CalculateSize($<imm_t.val>2);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>2;
-                                                    imm.val = $<imm_t.val>2;
+                                                    op[0].size = sz;
+                                                    op[0].isSym = $<imm_t.isSym>2;
+                                                    op[0].val = $<imm_t.val>2;
                                                 }else
                                                     erroneous = TRUE;
-                                                SCounter_t ret = GetIOBlockSize(MODE_IMM, reg, imm);
+                                                SCounter_t ret = GetIOBlockSize(MODE_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_IO, MODE_IMM, INB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_INB   reg               {
-                                                Register_t reg; Immediate_t imm;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetIOBlockSize(MODE_REG, reg, imm);
+                                                SCounter_t ret = GetIOBlockSize(MODE_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_IO, MODE_REG, INB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_INW   number            {
-                                                Register_t reg; Immediate_t imm;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                 uint8_t sz = CalculateSize($<imm_t.val>2);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>2;
-                                                    imm.val = $<imm_t.val>2;
+                                                    op[0].size = sz;
+                                                    op[0].isSym = $<imm_t.isSym>2;
+                                                    op[0].val = $<imm_t.val>2;
                                                 }else
                                                     erroneous = TRUE;
-                                                SCounter_t ret = GetIOBlockSize(MODE_IMM, reg, imm);
+                                                SCounter_t ret = GetIOBlockSize(MODE_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_IO, MODE_IMM, INW_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_INW   reg               {
-                                                Register_t reg; Immediate_t imm;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetIOBlockSize(MODE_REG, reg, imm);
+                                                SCounter_t ret = GetIOBlockSize(MODE_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_IO, MODE_REG, INW_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
              | INST_OUTB   number           {
-                                                Register_t reg; Immediate_t imm;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                 uint8_t sz = CalculateSize($<imm_t.val>2);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>2;
-                                                    imm.val = $<imm_t.val>2;
+                                                    op[0].size = sz;
+                                                    op[0].isSym = $<imm_t.isSym>2;
+                                                    op[0].val = $<imm_t.val>2;
                                                 }else
                                                     erroneous = TRUE;
-                                                SCounter_t ret = GetIOBlockSize(MODE_IMM, reg, imm);
+                                                SCounter_t ret = GetIOBlockSize(MODE_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_IO, MODE_IMM, OUTB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_OUTB   reg              {
-                                                Register_t reg; Immediate_t imm;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetIOBlockSize(MODE_REG, reg, imm);
+                                                SCounter_t ret = GetIOBlockSize(MODE_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_IO, MODE_REG, OUTB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_OUTW   number           {
-                                                Register_t reg; Immediate_t imm;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                 uint8_t sz = CalculateSize($<imm_t.val>2);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>2;
-                                                    imm.val = $<imm_t.val>2;
+                                                    op[0].size = sz;
+                                                    op[0].isSym = $<imm_t.isSym>2;
+                                                    op[0].val = $<imm_t.val>2;
                                                 }else
                                                     erroneous = TRUE;
-                                                SCounter_t ret = GetIOBlockSize(MODE_IMM, reg, imm);
+                                                SCounter_t ret = GetIOBlockSize(MODE_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_IO, MODE_IMM, OUTW_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_OUTW   reg              {
-                                                Register_t reg; Immediate_t imm;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetIOBlockSize(MODE_REG, reg, imm);
+                                                SCounter_t ret = GetIOBlockSize(MODE_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_IO, MODE_REG, OUTW_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
              | INST_LEA   reg ',' mem       {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
 
-                                                SCounter_t ret = GetAddressBlockSize(LEA_INST,  reg, mem);
+                                                SCounter_t ret = GetAddressBlockSize(LEA_INST, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ADDRESS, MODE_REG_MEM, LEA_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_LDS   reg ',' mem       {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
 
-                                                SCounter_t ret = GetAddressBlockSize(LDS_INST, reg, mem);
+                                                SCounter_t ret = GetAddressBlockSize(LDS_INST, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ADDRESS, MODE_REG_MEM, LDS_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
              | INST_LES   reg ',' mem       {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
 
-                                                SCounter_t ret = GetAddressBlockSize(LES_INST, reg, mem);
+                                                SCounter_t ret = GetAddressBlockSize(LES_INST, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ADDRESS, MODE_REG_MEM, LES_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
@@ -479,138 +557,150 @@ data_transfer: INST_MOV   reg  ',' reg      {
 ;
 
 arithmetic: INST_ADD  reg ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_REG, ADD_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_ADD  reg ',' mem           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_MEM, ADD_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_ADD  mem ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_MEM_REG, ADD_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_ADD  reg ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
                                                 
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, regd, regs, mem, imm);
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_IMM, ADD_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_ADD  mem ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, regd, regs, mem, imm);
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_MEM_IMM, ADD_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
           | INST_ADC  reg ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_REG, ADC_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_ADC  reg ',' mem           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_MEM, ADC_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_ADC  mem ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_MEM_REG, ADC_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_ADC  reg ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
                                                 
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, regd, regs, mem, imm);
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_IMM, ADC_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_ADC  mem ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, regd, regs, mem, imm);
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_MEM_IMM, ADC_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
           | INST_INC  reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetIncDecBlockSize(MODE_REG, reg, mem);
+                                                SCounter_t ret = GetIncDecBlockSize(MODE_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_INCDEC, MODE_REG, INC_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_INC  mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                SCounter_t ret = GetIncDecBlockSize(MODE_MEM, reg, mem);
+                                                SCounter_t ret = GetIncDecBlockSize(MODE_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_INCDEC, MODE_MEM, INC_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
@@ -618,215 +708,234 @@ arithmetic: INST_ADD  reg ',' reg           {
           | INST_DAA                        { SegmentTable[stsize-1].LC++; }
 
           | INST_SUB  reg ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_REG, SUB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_SUB  reg ',' mem           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_MEM, SUB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_SUB  mem ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_MEM_REG, SUB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_SUB  reg ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
                                                 
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, regd, regs, mem, imm);
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_IMM, SUB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_SUB  mem ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, regd, regs, mem, imm);
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_MEM_IMM, SUB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
           | INST_SBB  reg ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_REG, SBB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_SBB  reg ',' mem           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_MEM, SBB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_SBB  mem ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_MEM_REG, SBB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_SBB  reg ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
                                                 
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, regd, regs, mem, imm);
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_IMM, SBB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_SBB  mem ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, regd, regs, mem, imm);
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_MEM_IMM, SBB_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
           | INST_DEC  reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetIncDecBlockSize(MODE_REG, reg, mem);
+                                                SCounter_t ret = GetIncDecBlockSize(MODE_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_INCDEC, MODE_REG, DEC_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_DEC  mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                SCounter_t ret = GetIncDecBlockSize(MODE_MEM, reg, mem);
+                                                SCounter_t ret = GetIncDecBlockSize(MODE_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_INCDEC, MODE_MEM, DEC_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
           | INST_NEG  reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetArithmetic2Size(MODE_REG, reg, mem);
+                                                SCounter_t ret = GetArithmetic2Size(MODE_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH2, MODE_REG, NEG_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_NEG  mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                SCounter_t ret = GetArithmetic2Size(MODE_MEM, reg, mem);
+                                                SCounter_t ret = GetArithmetic2Size(MODE_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH2, MODE_MEM, NEG_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
           | INST_CMP  reg ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_REG, CMP_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_CMP  reg ',' mem           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_MEM, CMP_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_CMP  mem ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, regd, regs, mem, imm);
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_MEM_REG, CMP_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_CMP  reg ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
                                                 
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, regd, regs, mem, imm);
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_REG_IMM, CMP_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_CMP  mem ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, regd, regs, mem, imm);
+                                                SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH, MODE_MEM_IMM, CMP_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
@@ -834,76 +943,84 @@ arithmetic: INST_ADD  reg ',' reg           {
           | INST_DAS                        { SegmentTable[stsize-1].LC++; }
 
           | INST_MUL  reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetArithmetic2Size(MODE_REG, reg, mem);
+                                                SCounter_t ret = GetArithmetic2Size(MODE_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH2, MODE_REG, MUL_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_MUL  mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                SCounter_t ret = GetArithmetic2Size(MODE_MEM, reg, mem);
+                                                SCounter_t ret = GetArithmetic2Size(MODE_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH2, MODE_MEM, MUL_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
           | INST_IMUL reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetArithmetic2Size(MODE_REG, reg, mem);
+                                                SCounter_t ret = GetArithmetic2Size(MODE_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH2, MODE_REG, IMUL_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_IMUL mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                SCounter_t ret = GetArithmetic2Size(MODE_MEM, reg, mem);
+                                                SCounter_t ret = GetArithmetic2Size(MODE_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH2, MODE_MEM, IMUL_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
           | INST_AAM                        { SegmentTable[stsize-1].LC += 2; }
 
           | INST_DIV  reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetArithmetic2Size(MODE_REG, reg, mem);
+                                                SCounter_t ret = GetArithmetic2Size(MODE_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH2, MODE_REG, DIV_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_DIV  mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                SCounter_t ret = GetArithmetic2Size(MODE_MEM, reg, mem);
+                                                SCounter_t ret = GetArithmetic2Size(MODE_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH2, MODE_MEM, DIV_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
           | INST_IDIV reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                SCounter_t ret = GetArithmetic2Size(MODE_REG, reg, mem);
+                                                SCounter_t ret = GetArithmetic2Size(MODE_REG, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH2, MODE_REG, IDIV_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
           | INST_IDIV mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                SCounter_t ret = GetArithmetic2Size(MODE_MEM, reg, mem);
+                                                SCounter_t ret = GetArithmetic2Size(MODE_MEM, op);
                                                 if(ret < 0) erroneous = TRUE;
+                                                RecordIR(ENC_ARITH2, MODE_MEM, IDIV_INST, op);
                                                 SegmentTable[stsize-1].LC += ret;
                                             }
 
@@ -913,539 +1030,592 @@ arithmetic: INST_ADD  reg ',' reg           {
 ;
 
 bit_manipulation: INST_NOT  reg                 {
-                                                    Register_t reg; Memory_t mem;
-                                                    reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    SCounter_t ret = GetArithmetic2Size(MODE_REG, reg, mem);
+                                                    SCounter_t ret = GetArithmetic2Size(MODE_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH2, MODE_REG, NOT_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_NOT  mem                 {
-                                                    Register_t reg; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    SCounter_t ret = GetArithmetic2Size(MODE_MEM, reg, mem);
+                                                    SCounter_t ret = GetArithmetic2Size(MODE_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH2, MODE_MEM, NOT_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_AND  reg ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, regd, regs, mem, imm);
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_REG_REG, AND_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_AND  reg ',' mem         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                    mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, regd, regs, mem, imm);
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                    op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_REG_MEM, AND_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_AND  mem ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, regd, regs, mem, imm);
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_MEM_REG, AND_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_AND  reg ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
                                                 
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, regd, regs, mem, imm);
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_REG_IMM, AND_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_AND  mem ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
 
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, regd, regs, mem, imm);
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_MEM_IMM, AND_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_OR   reg ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, regd, regs, mem, imm);
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_REG_REG, OR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_OR   reg ',' mem         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                    mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, regd, regs, mem, imm);
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                    op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_REG_MEM, OR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_OR   mem ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, regd, regs, mem, imm);
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_MEM_REG, OR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_OR   reg ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
                                                 
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, regd, regs, mem, imm);
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_REG_IMM, OR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_OR   mem ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
 
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, regd, regs, mem, imm);
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_MEM_IMM, OR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_XOR  reg ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, regd, regs, mem, imm);
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_REG_REG, XOR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_XOR  reg ',' mem         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                    mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, regd, regs, mem, imm);
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                    op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_REG_MEM, XOR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_XOR  mem ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, regd, regs, mem, imm);
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_MEM_REG, XOR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_XOR  reg ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
                                                 
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, regd, regs, mem, imm);
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_REG_IMM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_REG_IMM, XOR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_XOR  mem ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
 
-                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, regd, regs, mem, imm);
+                                                    SCounter_t ret = GetArithmeticBlockSize(MODE_MEM_IMM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_ARITH, MODE_MEM_IMM, XOR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_TEST reg ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
-                                                    SCounter_t ret = GetTestSize(MODE_REG_REG, regd, regs, mem, imm);
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                    SCounter_t ret = GetTestSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_TEST, MODE_REG_REG, 0, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_TEST reg ',' mem         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                    mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
-                                                    SCounter_t ret = GetTestSize(MODE_REG_MEM, regd, regs, mem, imm);
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                    op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
+                                                    SCounter_t ret = GetTestSize(MODE_REG_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_TEST, MODE_REG_MEM, 0, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_TEST reg ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
                                                 
-                                                    SCounter_t ret = GetTestSize(MODE_REG_IMM, regd, regs, mem, imm);
+                                                    SCounter_t ret = GetTestSize(MODE_REG_IMM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_TEST, MODE_REG_IMM, 0, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_TEST mem ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
 
-                                                    SCounter_t ret = GetTestSize(MODE_MEM_IMM, regd, regs, mem, imm);
+                                                    SCounter_t ret = GetTestSize(MODE_MEM_IMM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_TEST, MODE_MEM_IMM, 0, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_SHL reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG, SHL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SHL reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG_REG, SHL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SHL mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM, SHL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SHL mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM_REG, SHL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_SAL reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG, SAL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SAL reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG_REG, SAL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SAL mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM, SAL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SAL mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM_REG, SAL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_SHR reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG, SHR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SHR reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG_REG, SHR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SHR mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM, SHR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SHR mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM_REG, SHR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_SAR reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG, SAR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SAR reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG_REG, SAR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SAR mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM, SAR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_SAR mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM_REG, SAR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_ROL reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG, ROL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_ROL reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG_REG, ROL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_ROL mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM, ROL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_ROL mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM_REG, ROL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_ROR reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG, ROR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_ROR reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG_REG, ROR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_ROR mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM, ROR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_ROR mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM_REG, ROR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_RCL reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG, RCL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_RCL reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG_REG, RCL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_RCL mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM, RCL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_RCL mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM_REG, RCL_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 
                 | INST_RCR reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG, RCR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_RCR reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_REG_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_REG_REG, RCR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_RCR mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM, RCR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
                 | INST_RCR mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, regd, regs, mem);
+                                                    SCounter_t ret = GetShiftRotateBlockSize(MODE_MEM_REG, op);
                                                     if(ret < 0) erroneous = TRUE;
+                                                    RecordIR(ENC_SHIFT, MODE_MEM_REG, RCR_INST, op);
                                                     SegmentTable[stsize-1].LC += ret;
                                                 }
 ;
@@ -1468,148 +1638,160 @@ string_operation: INST_REP                      { SegmentTable[stsize-1].LC++; }
 ;
 
 program_transfer: INST_CALLF  number ':' number     {
-                                                        Memory_t mem; Immediate_t imm1, imm2;
-                                                        imm1.size = SZ_WORD; imm1.isSym = $<imm_t.isSym>2; imm1.val = $<imm_t.val>2;
-                                                        imm2.size = SZ_WORD; imm2.isSym = $<imm_t.isSym>4; imm2.val = $<imm_t.val>4;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM }, { .kind = OPERAND_IMM } };
+                                                        op[0].size = SZ_WORD; op[0].isSym = $<imm_t.isSym>2; op[0].val = $<imm_t.val>2;
+                                                        op[1].size = SZ_WORD; op[1].isSym = $<imm_t.isSym>4; op[1].val = $<imm_t.val>4;
 
-                                                        SCounter_t ret = GetFarOpSize(MODE_IMM_IMM, mem, imm1, imm2);
+                                                        SCounter_t ret = GetFarOpSize(MODE_IMM_IMM, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_FAROP, MODE_IMM_IMM, CALLF_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
                 | INST_CALLF  mem                   {
-                                                        Memory_t mem; Immediate_t imm1, imm2;
-                                                        mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                        mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                        op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                        op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                        SCounter_t ret = GetFarOpSize(MODE_MEM, mem, imm1, imm2);
+                                                        SCounter_t ret = GetFarOpSize(MODE_MEM, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_FAROP, MODE_MEM, CALLF_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
 
                 | INST_CALLN  number                {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                         uint8_t sz = CalculateSize($<imm_t.val>2);
                                                         if(sz != SZ_ERR){
-                                                            imm.size = sz;
-                                                            imm.isSym = $<imm_t.isSym>2;
-                                                            imm.val = $<imm_t.val>2;
+                                                            op[0].size = sz;
+                                                            op[0].isSym = $<imm_t.isSym>2;
+                                                            op[0].val = $<imm_t.val>2;
                                                         }else
                                                             erroneous = TRUE;
                                                         
-                                                        SCounter_t ret = GetNearOpSize(MODE_IMM, reg, mem, imm);
+                                                        SCounter_t ret = GetNearOpSize(MODE_IMM, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_NEAROP, MODE_IMM, CALLN_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
                 | INST_CALLN  reg                   {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
-                                                        reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                        op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                        SCounter_t ret = GetNearOpSize(MODE_REG, reg, mem, imm);
+                                                        SCounter_t ret = GetNearOpSize(MODE_REG, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_NEAROP, MODE_REG, CALLN_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
                 | INST_CALLN  mem                   {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
-                                                        mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                        mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                        op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                        op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                         
-                                                        SCounter_t ret = GetNearOpSize(MODE_MEM, reg, mem, imm);
+                                                        SCounter_t ret = GetNearOpSize(MODE_MEM, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_NEAROP, MODE_MEM, CALLN_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
 
                 | INST_RETN                         {
-                                                        Immediate_t imm;
-                                                        
-                                                        SCounter_t ret = GetReturnBlockSize(MODE_NO_OPERAND, imm);
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_NONE } };
+                                                        SCounter_t ret = GetReturnBlockSize(MODE_NO_OPERAND, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_RETURN, MODE_NO_OPERAND, RETN_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
                 | INST_RETN  number                 {
-                                                        Immediate_t imm;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                         uint8_t sz = CalculateSize($<imm_t.val>2);
                                                         if(sz != SZ_ERR){
-                                                            imm.size = sz;
-                                                            imm.isSym = $<imm_t.isSym>2;
-                                                            imm.val = $<imm_t.val>2;
+                                                            op[0].size = sz;
+                                                            op[0].isSym = $<imm_t.isSym>2;
+                                                            op[0].val = $<imm_t.val>2;
                                                         }else
                                                             erroneous = TRUE;
                                                         
-                                                        SCounter_t ret = GetReturnBlockSize(MODE_IMM, imm);
+                                                        SCounter_t ret = GetReturnBlockSize(MODE_IMM, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_RETURN, MODE_IMM, RETN_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
 
                 | INST_RETF                         {
-                                                        Immediate_t imm;
-                                                        
-                                                        SCounter_t ret = GetReturnBlockSize(MODE_NO_OPERAND, imm);
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_NONE } };
+                                                        SCounter_t ret = GetReturnBlockSize(MODE_NO_OPERAND, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_RETURN, MODE_NO_OPERAND, RETF_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
                 | INST_RETF  number                 {
-                                                        Immediate_t imm;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                         uint8_t sz = CalculateSize($<imm_t.val>2);
                                                         if(sz != SZ_ERR){
-                                                            imm.size = sz;
-                                                            imm.isSym = $<imm_t.isSym>2;
-                                                            imm.val = $<imm_t.val>2;
+                                                            op[0].size = sz;
+                                                            op[0].isSym = $<imm_t.isSym>2;
+                                                            op[0].val = $<imm_t.val>2;
                                                         }else
                                                             erroneous = TRUE;
                                                         
-                                                        SCounter_t ret = GetReturnBlockSize(MODE_IMM, imm);
+                                                        SCounter_t ret = GetReturnBlockSize(MODE_IMM, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_RETURN, MODE_IMM, RETF_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
 
                 | INST_JMPF  number ':' number      {
-                                                        Memory_t mem; Immediate_t imm1, imm2;
-                                                        imm1.size = SZ_WORD; imm1.isSym = $<imm_t.isSym>2; imm1.val = $<imm_t.val>2;
-                                                        imm2.size = SZ_WORD; imm2.isSym = $<imm_t.isSym>4; imm2.val = $<imm_t.val>4;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM }, { .kind = OPERAND_IMM } };
+                                                        op[0].size = SZ_WORD; op[0].isSym = $<imm_t.isSym>2; op[0].val = $<imm_t.val>2;
+                                                        op[1].size = SZ_WORD; op[1].isSym = $<imm_t.isSym>4; op[1].val = $<imm_t.val>4;
 
-                                                        SCounter_t ret = GetFarOpSize(MODE_IMM_IMM, mem, imm1, imm2);
+                                                        SCounter_t ret = GetFarOpSize(MODE_IMM_IMM, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_FAROP, MODE_IMM_IMM, JMPF_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
                 | INST_JMPF  mem                    {
-                                                        Memory_t mem; Immediate_t imm1, imm2;
-                                                        mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                        mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                        op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                        op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                        SCounter_t ret = GetFarOpSize(MODE_MEM, mem, imm1, imm2);
+                                                        SCounter_t ret = GetFarOpSize(MODE_MEM, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_FAROP, MODE_MEM, JMPF_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
 
                 | INST_JMPN  number                 {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                         uint8_t sz = CalculateSize($<imm_t.val>2);
                                                         if(sz != SZ_ERR){
-                                                            imm.size = sz;
-                                                            imm.isSym = $<imm_t.isSym>2;
-                                                            imm.val = $<imm_t.val>2;
+                                                            op[0].size = sz;
+                                                            op[0].isSym = $<imm_t.isSym>2;
+                                                            op[0].val = $<imm_t.val>2;
                                                         }else
                                                             erroneous = TRUE;
                                                         
-                                                        SCounter_t ret = GetNearOpSize(MODE_IMM, reg, mem, imm);
+                                                        SCounter_t ret = GetNearOpSize(MODE_IMM, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_NEAROP, MODE_IMM, JMPN_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
                 | INST_JMPN  reg                    {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
-                                                        reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                        op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                         
-                                                        SCounter_t ret = GetNearOpSize(MODE_REG, reg, mem, imm);
+                                                        SCounter_t ret = GetNearOpSize(MODE_REG, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_NEAROP, MODE_REG, JMPN_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
                 | INST_JMPN  mem                    {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
-                                                        mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                        mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                        op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                        op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                         
-                                                        SCounter_t ret = GetNearOpSize(MODE_MEM, reg, mem, imm);
+                                                        SCounter_t ret = GetNearOpSize(MODE_MEM, op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_NEAROP, MODE_MEM, JMPN_INST, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
 
@@ -1653,17 +1835,18 @@ program_transfer: INST_CALLF  number ':' number     {
                 | INST_JCXZ  number                 { SegmentTable[stsize-1].LC += 2; }
 
                 | INST_INT   number                 {
-                                                        Immediate_t imm;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                         uint8_t sz = CalculateSize($<imm_t.val>2);
                                                         if(sz != SZ_ERR){
-                                                            imm.size = sz;
-                                                            imm.isSym = $<imm_t.isSym>2;
-                                                            imm.val = $<imm_t.val>2;
+                                                            op[0].size = sz;
+                                                            op[0].isSym = $<imm_t.isSym>2;
+                                                            op[0].val = $<imm_t.val>2;
                                                         }else
                                                             erroneous = TRUE;
                                                         
-                                                        SCounter_t ret = GetInterruptSize(imm);
+                                                        SCounter_t ret = GetInterruptSize(op);
                                                         if(ret < 0) erroneous = TRUE;
+                                                        RecordIR(ENC_INT, MODE_IMM, 0, op);
                                                         SegmentTable[stsize-1].LC += ret;
                                                     }
 
@@ -1694,147 +1877,72 @@ processor_control: INST_STC                     { SegmentTable[stsize-1].LC++; }
 
 
 mem: size '['  number ']'                           {
+                                                        // Direct address, always a 16-bit displacement
+                                                        const AddrMode_t *ea = ADDRESS_MODE(BASE_NONE, IDX_NONE, DISP_WORD);
                                                         $<mem_t.size>$  = $<ival>1;
                                                         $<mem_t.isSym>$ = $<imm_t.isSym>3;
-                                                        $<mem_t.mod>$   = 0b00000000;           // Memory Mode
-                                                        $<mem_t.rm>$    = 0b00000110;           // Direct Address 16-bit displacement
-                                                        $<mem_t.disp>$ = $<imm_t.val>3;
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = $<imm_t.val>3;
                                                     }
    | size '['  base   ']'                           {
+                                                        // [BP] has no mode without displacement, it is [BP:0]
+                                                        const AddrMode_t *ea = ADDRESS_MODE($<ival>3, IDX_NONE, DISP_NONE);
                                                         $<mem_t.size>$  = $<ival>1;
                                                         $<mem_t.isSym>$ = FALSE;
-                                                        // Calculate Mod
-                                                        // There is no disp except for BP. If BP, then mod = 01 and rm = 110, disp = 0x00
-                                                        switch($<ival>3){
-                                                            case BASE_REG:
-                                                                $<mem_t.mod>$ = 0b00000000;
-                                                                $<mem_t.rm>$  = 0b00000111;
-                                                                break;
-                                                            case BASE_PTR:
-                                                                $<mem_t.mod>$ = 0b00000001;
-                                                                $<mem_t.rm>$  = 0b00000110;
-                                                                break;
-                                                        }
-                                                        $<mem_t.disp>$ = 0x0000;
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = 0x0000;
                                                     }
    | size '['  index  ']'                           {
+                                                        const AddrMode_t *ea = ADDRESS_MODE(BASE_NONE, $<ival>3, DISP_NONE);
                                                         $<mem_t.size>$  = $<ival>1;
                                                         $<mem_t.isSym>$ = FALSE;
-                                                        $<mem_t.mod>$   = 0b00000000;
-                                                        switch($<ival>3){
-                                                            case IDX_SOURCE:
-                                                                $<mem_t.rm>$ = 0b00000100;
-                                                                break;
-                                                            case IDX_DESTINATION:
-                                                                $<mem_t.rm>$ = 0b00000101;
-                                                                break;
-                                                            default:
-                                                                PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                                erroneous = TRUE;
-                                                                break;
-                                                         }
-                                                         $<mem_t.disp>$ = 0x0000;
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = 0x0000;
                                                     }
    | size '['  index  ':'  number ']'               {
-                                                        $<mem_t.size>$ = $<ival>1;
-                                                        $<mem_t.isSym>$ = $<imm_t.isSym>3;
-                                                        switch($<ival>3){
-                                                            case IDX_SOURCE:
-                                                                $<mem_t.rm>$ = 0b00000100;
-                                                                break;
-                                                            case IDX_DESTINATION:
-                                                                $<mem_t.rm>$ = 0b00000101;
-                                                                break;
-                                                        }
-                                                        short int tmp = $<imm_t.val>5;
-                                                        uint8_t sz = CalculateSize(tmp);
-                                                        if(sz == SZ_BYTE){
-                                                            $<mem_t.mod>$ = 0x01;
-                                                            $<mem_t.disp>$ = $<imm_t.val>5;
-                                                        }else if(sz == SZ_WORD){
-                                                            $<mem_t.mod>$ = 0x02;
-                                                            $<mem_t.disp>$ = $<imm_t.val>5;
-                                                        }else{
-                                                            PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                            erroneous = TRUE;
-                                                        }
+                                                        uint8_t disp = ( ($<imm_t.isSym>5 == FALSE) && (CalculateSize($<imm_t.val>5) == SZ_BYTE) ) ? DISP_BYTE : DISP_WORD;
+                                                        const AddrMode_t *ea = ADDRESS_MODE(BASE_NONE, $<ival>3, disp);
+                                                        $<mem_t.size>$  = $<ival>1;
+                                                        $<mem_t.isSym>$ = $<imm_t.isSym>5;
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = $<imm_t.val>5;
                                                     }
    | size '['  base   ':'  number ']'               {
-                                                        $<mem_t.size>$ = $<ival>1;
-                                                        $<mem_t.isSym>$ = $<imm_t.isSym>3;
-                                                        switch($<ival>3){
-                                                            case BASE_REG:
-                                                                $<mem_t.rm>$ = 0b00000111;
-                                                                break;
-                                                            case BASE_PTR:
-                                                                $<mem_t.rm>$ = 0b00000110;
-                                                                break;
-                                                            default:
-                                                                PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                                erroneous = TRUE;
-                                                        }
-                                                        short int tmp = $<imm_t.val>5;
-                                                        uint8_t sz = CalculateSize(tmp);
-                                                        if(sz == SZ_BYTE){
-                                                            $<mem_t.mod>$ = 0x01;
-                                                            $<mem_t.disp>$ = $<imm_t.val>5;
-                                                        }else if( sz == SZ_WORD ){
-                                                            $<mem_t.mod>$ = 0x02;
-                                                            $<mem_t.disp>$ = $<imm_t.val>5;
-                                                        }else{
-                                                            PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                            erroneous = TRUE;
-                                                        }
+                                                        uint8_t disp = ( ($<imm_t.isSym>5 == FALSE) && (CalculateSize($<imm_t.val>5) == SZ_BYTE) ) ? DISP_BYTE : DISP_WORD;
+                                                        const AddrMode_t *ea = ADDRESS_MODE($<ival>3, IDX_NONE, disp);
+                                                        $<mem_t.size>$  = $<ival>1;
+                                                        $<mem_t.isSym>$ = $<imm_t.isSym>5;
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = $<imm_t.val>5;
                                                     }
    | size '['  base   ':'  index  ']'               {
-                                                        $<mem_t.size>$ = $<ival>1;
+                                                        const AddrMode_t *ea = ADDRESS_MODE($<ival>3, $<ival>5, DISP_NONE);
+                                                        $<mem_t.size>$  = $<ival>1;
                                                         $<mem_t.isSym>$ = FALSE;
-                                                        if( ($<ival>3 == BASE_REG) && ($<ival>5 == IDX_SOURCE) ){
-                                                            $<mem_t.mod>$ = 0x00;
-                                                            $<mem_t.rm>$  = 0x00;
-                                                            $<mem_t.disp>$ = 0x00;
-                                                        }else if( ($<ival>3 == BASE_REG) && ($<ival>5 == IDX_DESTINATION) ){
-                                                            $<mem_t.mod>$ = 0x00;
-                                                            $<mem_t.rm>$  = 0x01;
-                                                            $<mem_t.disp>$ = 0x00;
-                                                        }else if( ($<ival>3 == BASE_PTR) && ($<ival>5 == IDX_SOURCE) ){
-                                                            $<mem_t.mod>$ = 0x00;
-                                                            $<mem_t.rm>$  = 0x02;
-                                                            $<mem_t.disp>$ = 0x00;
-                                                        }else if( ($<ival>3 == BASE_PTR) && ($<ival>5 == IDX_DESTINATION) ){
-                                                            $<mem_t.mod>$ = 0x00;
-                                                            $<mem_t.rm>$  = 0x03;
-                                                            $<mem_t.disp>$ = 0x00;
-                                                        }else{
-                                                            PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                            erroneous = TRUE;
-                                                        }
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = 0x0000;
                                                     }
    | size '['  base   ':'  index ':' number ']'     {
-                                                        $<mem_t.size>$ = $<ival>1;
+                                                        uint8_t disp = ( ($<imm_t.isSym>7 == FALSE) && (CalculateSize($<imm_t.val>7) == SZ_BYTE) ) ? DISP_BYTE : DISP_WORD;
+                                                        const AddrMode_t *ea = ADDRESS_MODE($<ival>3, $<ival>5, disp);
+                                                        $<mem_t.size>$  = $<ival>1;
                                                         $<mem_t.isSym>$ = $<imm_t.isSym>7;
-                                                        short int tmp = $<imm_t.val>7;
-                                                        uint8_t sz = CalculateSize(tmp);
-                                                        if( ($<ival>3 == BASE_REG) && ($<ival>5 == IDX_SOURCE) ){
-                                                            $<mem_t.mod>$ = (sz == SZ_WORD) ? 0x02 : 0x01;
-                                                            $<mem_t.rm>$  = 0x00;
-                                                            $<mem_t.disp>$ = $<imm_t.val>7;
-                                                        }else if( ($<ival>3 == BASE_REG) && ($<ival>5 == IDX_DESTINATION) ){
-                                                            $<mem_t.mod>$ = (sz == SZ_WORD) ? 0x02 : 0x01;
-                                                            $<mem_t.rm>$  = 0x01;
-                                                            $<mem_t.disp>$ = $<imm_t.val>7;
-                                                        }else if( ($<ival>3 == BASE_PTR) && ($<ival>5 == IDX_SOURCE) ){
-                                                            $<mem_t.mod>$ = (sz == SZ_WORD) ? 0x02 : 0x01;
-                                                            $<mem_t.rm>$  = 0x02;
-                                                            $<mem_t.disp>$ = $<imm_t.val>7;
-                                                        }else if( ($<ival>3 == BASE_PTR) && ($<ival>5 == IDX_DESTINATION) ){
-                                                            $<mem_t.mod>$ = (sz == SZ_WORD) ? 0x02 : 0x01;
-                                                            $<mem_t.rm>$  = 0x03;
-                                                            $<mem_t.disp>$ = $<imm_t.val>7;
-                                                        }else{
-                                                            PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                            erroneous = TRUE;
-                                                        }
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = $<imm_t.val>7;
                                                     }
 ;
 
@@ -1927,8 +2035,14 @@ sreg: SREG_CS   { $<ival>$ = SREG_CODE;    }
 ;
 
 
-number: NUMBER                  { $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$ = FALSE; }
-      | SEGNAME                 { $<imm_t.val>$ = 0; $<imm_t.isSym>$ = TRUE; }
+number: NUMBER                  {
+                                    if( ($<imm_t.wide>1 > 32767) || ($<imm_t.wide>1 < -32768) ){
+                                        PrintError(COLOR_BOLDRED, "Line %d :: Number size overflow!\n", LN);
+                                        erroneous = TRUE;
+                                    }
+                                    $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$ = FALSE;
+                                }
+      | SEGNAME                 { $<imm_t.val>$ = 0; $<imm_t.isSym>$ = TRUE; SegmentRefs++; }
       | LABEL                   { $<imm_t.val>$ = 0; $<imm_t.isSym>$ = TRUE; }
       | DIR_HERE                { $<imm_t.val>$ = SegmentTable[stsize-1].LC; $<imm_t.isSym>$ = FALSE; }
       | number '+' number       {
@@ -1960,7 +2074,7 @@ number: NUMBER                  { $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$
                                     else
                                         $<imm_t.isSym>$ = FALSE;
                                     }else{
-                                        PrintError(COLOR_BOLDYELLOW, "Line %d :: Division by 0\n", LN);
+                                        PrintError(COLOR_RED, "Line %d :: Division by 0\n", LN);
                                         erroneous = TRUE;
                                     }
                                 }
@@ -1992,9 +2106,27 @@ number: NUMBER                  { $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$
 ;
 
 
+
+/* Repeat counts are not limited to 16 bits */
+count: NUMBER                   { $<lval>$ = $<imm_t.wide>1; }
+     | DIR_HERE                 { $<lval>$ = SegmentTable[stsize-1].LC; }
+     | count '+' count          { $<lval>$ = $<lval>1 + $<lval>3; }
+     | count '-' count          { $<lval>$ = $<lval>1 - $<lval>3; }
+     | count '*' count          { $<lval>$ = $<lval>1 * $<lval>3; }
+     | count '/' count          {
+                                    if( $<lval>3 != 0 ){
+                                        $<lval>$ = $<lval>1 / $<lval>3;
+                                    }else{
+                                        PrintError(COLOR_RED, "Line %d :: Division by 0\n", LN);
+                                        erroneous = TRUE;
+                                        $<lval>$ = 0;
+                                    }
+                                }
+;
 %%
 
 void yyerror(const char *s)
 {
-    PrintError(COLOR_BOLDYELLOW, "Line %d, %s\n", LN, s);
+    PrintError(COLOR_RED, "Line %d, %s\n", LN, s);
+    DropIR();
 }
@@ -12,6 +12,7 @@
 #include <string.h>
 #include <stdint.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <sys/ipc.h>
@@ -19,16 +20,19 @@
 #include "../../include/Definitions.h"
 #include "../../include/Errors.h"
 #include "../../include/Assembler.h"
+#include "../../include/Options.h"
+#include "../../include/Tokens.h"
 #include "Pass1-Scanner.h"
 
 /* Global Variables */
 LCounter_t LN;
-MCounter_t LC;
+LCounter_t LC;
 Boolean_t erroneous;
 Flag_t isSOP;                     // Is segment is overwritten
 Flag_t isORG;                     // Is ORG directive used
 uint8_t SOP;
 Fname_t SrcFile;
+char *SourceName;                   // Source given to qasm, the file of the diagnostics
 FILE *fdest;
 
 /* Tables */
@@ -37,40 +41,109 @@ Label_t *LabelTable;
 size_t ltsize;
 size_t stsize;
 Symbol_t *SymbolTable;
+LCounter_t SegmentRefs;             // Segment references, sizes the relocation table of an executable
+
+/* Input */
+SourceBuffer_t Source;              // Mapped preprocessed file
+FILE *fsrc;                         // Preprocessed file in streaming mode
 
 /* Error Functions/Variables */
 extern uint8_t errcode;
 extern void PrintError(char *color, char *format, ...);
 extern void InternalError(char *format, ...);
 extern void ExternalError(char *format, ...);
+extern void FlushDiagnostics(void);
+extern void NameDiagnosticsFile(const char *path);
 
 /* Flex/Bison Functions/Variables */
 extern int yylex();
 extern int yyparse();
 extern FILE *yyin;
 
+/* Options */
+extern Options_t Options;
+extern void DecodeOptions(int argc, char **argv);
+extern char **ComposeArguments(char *prog, ...);
+
+/* Source Mapping */
+extern Boolean_t MapSourceFile(const char *path, SourceBuffer_t *src);
+extern void UnmapSourceFile(SourceBuffer_t *src);
+
+/* Tokenized Sources */
+extern Boolean_t IsTokenFile(const char *path);
+extern Boolean_t OpenTokenFile(const char *path);
+extern void CloseTokenFile(void);
+extern Boolean_t StartTokenRecord(void);
+extern Boolean_t WriteTokenFile(const char *src);
+extern size_t ShareTokenRecord(const char *path);
+extern void ReleaseTokenShare(void);
+extern void EndTokenRecord(void);
+extern Flag_t TokenInput;
+extern Flag_t TokenOutput;
+
+/* Instruction IR */
+extern Boolean_t StartIR(void);
+extern size_t ShareIR(const char *path);
+extern void ReleaseIR(void);
+
+/* Layout */
+extern Boolean_t PrintLayout(FILE *out);
+
 /* Pass1 Function Declerations */
 void InitializePass1(void);
 void ExitSafely(int retcode);
 void StartPass2(void);
+void ReportLayout(void);
 int main(int argc, char **argv);
 
 /* Pass1 Function Definitions */
 int main(int argc, char **argv)
 {
     InitializePass1();
+    DecodeOptions(argc-3, argv+3);
+    SourceName = argv[1];
+    NameDiagnosticsFile(SourceName);
 
-    fdest = fopen(argv[2], "r");
-    if(!fdest){
-        ExternalError("Failed to open source file: ");
-        exit(EXIT_FAILURE);
-    }
     strcpy(SrcFile, argv[2]);
-
-    yyin = fdest;
+    if(IsTokenFile(argv[2]) == TRUE){
+        // Tokens replace the preprocessed text, there is nothing to scan
+        if(OpenTokenFile(argv[2]) == FALSE){
+            ExternalError("Failed to open source file: ");
+            exit(EXIT_FAILURE);
+        }
+    }else if(Options.stream == SET){
+        // Read through a fixed buffer, a mapping would keep the pages flex writes into
+        fsrc = fopen(argv[2], "r");
+        if(!fsrc){
+            ExternalError("Failed to open source file: ");
+            exit(EXIT_FAILURE);
+        }
+        setvbuf(fsrc, NULL, _IOFBF, STREAM_BUFSIZE);
+        posix_fadvise(fileno(fsrc), 0, 0, POSIX_FADV_SEQUENTIAL);
+        yyin = fsrc;
+    }else{
+        if(MapSourceFile(argv[2], &Source) == FALSE){
+            ExternalError("Failed to open source file: ");
+            exit(EXIT_FAILURE);
+        }
+        // Scanned in place, the mapping already ends with two NULs
+        yy_scan_buffer(Source.base, Source.len+2);
+    }
+    // Pass 2 replays the tokens instead of scanning, --stream keeps memory bounded and scans twice
+    if( (TokenInput == NSET) && ( (Options.tokens == SET) ||
+        ((Options.stream == NSET) && (Options.layout == LAYOUT_NONE)) ) && (StartTokenRecord() == FALSE) )
+        ExitSafely(EXIT_FAILURE);
+    // Instructions of the recorded lines, pass 2 encodes them without parsing
+    if( (TokenOutput == SET) && (StartIR() == FALSE) )
+        ExitSafely(EXIT_FAILURE);
     yyparse();
+    if( (Options.tokens == SET) && (TokenInput == NSET) && (WriteTokenFile(argv[1]) == FALSE) )
+        ExitSafely(EXIT_FAILURE);
+
+    /* Sizes are known now, report them without assembling */
+    if(Options.layout != LAYOUT_NONE)
+        ReportLayout();
 
-    
     /* Call Pass2 Assembler */
     StartPass2();
 
@@ -97,6 +170,7 @@ void InitializePass1(void)
     stsize = 0;             // Segment Table index is 0, initially
 
     SymbolTable = NULL;
+    fsrc = NULL;
 
     return;
 }
@@ -152,17 +226,21 @@ void StartPass2(void)
     
     char symtabsize[50];
     sprintf(symtabsize, "%ld", (stsize+ltsize));
-
+    char segrefs[50];
+    sprintf(segrefs, "%u", SegmentRefs);
+    char toksize[50];
+    size_t tokens = ShareTokenRecord(SrcFile);
+    sprintf(toksize, "%lu", tokens);
+    char irsize[50];
+    sprintf(irsize, "%lu", (tokens > 0) ? ShareIR(SrcFile) : 0);   // The IR names lines of the tokens
+
+    FlushDiagnostics();             // Before the ones of pass 2, the child would print them again
     pid_t pid = fork();
     if(pid < 0){
         ExternalError("Failed to start assembling: ");
         exit(EXIT_FAILURE);
     }else if(pid == 0){
-        char **argv = malloc(4*sizeof(char*));
-        argv[0] = strdup("qasm-pass2");
-        argv[1] = strdup(symtabsize);
-        argv[2] = strdup(SrcFile);
-        argv[3] = NULL;
+        char **argv = ComposeArguments("qasm-pass2", symtabsize, SrcFile, segrefs, toksize, irsize, SourceName, NULL);
 
         ret = execvp(argv[0], argv);
         if(ret == -1){
@@ -171,6 +249,8 @@ void StartPass2(void)
         }
     }else{
         waitpid(pid, &status, 0);
+        ReleaseTokenShare();
+        ReleaseIR();
         if( WIFEXITED(status) )
             if(WEXITSTATUS(status) != EXIT_SUCCESS)
                 exit(EXIT_FAILURE);                 // If assembler encountered an error, it displayed
@@ -192,9 +272,34 @@ void StartPass2(void)
 }
 
 
+/* --size-only and --symbols-only end here. Pass 2 would remove the
+   preprocessed file, so it is removed in its place */
+void ReportLayout(void)
+{
+    if(IsTokenFile(SrcFile) == FALSE)
+        remove(SrcFile);
+    if(erroneous == TRUE)
+        ExitSafely(EXIT_FAILURE);
+
+    size_t index;
+    for(index=0; index<stsize; index++)
+        SegmentTable[index].size = SegmentTable[index].LC;
+
+    if(PrintLayout(stdout) == FALSE)
+        ExitSafely(EXIT_FAILURE);
+    ExitSafely(EXIT_SUCCESS);
+}
+
+
 void ExitSafely(int retcode)
 {
-    fclose(yyin);           // Close the flex/bison buffer
+    UnmapSourceFile(&Source);   // Release the scanned source
+    if(fsrc)
+        fclose(fsrc);
+    CloseTokenFile();
+    EndTokenRecord();
+    ReleaseTokenShare();
+    ReleaseIR();
     free(SegmentTable);     // Remove Segment Table
     free(LabelTable);       // Remove Label Table
     //free(fdest);            // Remove formerly used file descriptor
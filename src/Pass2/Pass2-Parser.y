@@ -15,17 +15,21 @@
 #include "../../include/Errors.h"
 #include "../../include/Assembler.h"
 #include "../../include/Encoding.h"
+#include "../../include/Options.h"
 
 
 /* Global Variables */
 extern Boolean_t erroneous;                // Is there any error?
 extern Fname_t SrcFile;                    // Source File to be scanned/parsed
 extern LCounter_t LN;                      // Line Number
-extern MCounter_t LC;                      // Global Location Counter
+extern LCounter_t LC;                      // Global Location Counter
 extern Flag_t isORG;                       // Is ORG directive used
 extern Flag_t isSOP;                       // Is segment is overwridden
 extern uint8_t SOP;                        // Overridden Segment
 
+/* Options */
+extern Options_t Options;
+
 /* Tables */
 extern Segment_t *SegmentTable;            // Segments
 extern Label_t *LabelTable;                // Labels
@@ -36,6 +40,7 @@ extern size_t ltsize;                      // Segment Table Size
 /* Miscellaneous Functions */
 extern uint8_t Convert2UnsignedByte(short int val);
 extern SCounter_t CalculateSize(short int val);         // Calculate the size of a number
+extern const AddrMode_t AddressModes[EA_BASES][EA_INDEXES][DISP_CLASSES];
 extern Boolean_t CheckSignExtension(short int val);     // Check a number if it's sign extended
 extern short int ComputeFactorial(short int number);    // Do factorial computation
 extern size_t CheckLabelExistence(char *sname);         // Get the index of a label
@@ -48,26 +53,48 @@ extern void PrintError(char *color, char *format, ...);     // Print Custom Erro
 extern void InternalError(char *format, ...);               // Print Internal Error
 extern void ExternalError(char *format, ...);               // Print External Error
 
+#define SERIES_INITCAP 16        // Initial capacity of a PUT data series
+
 /* Encoder Functions */
-extern void WriteByte2File(uint8_t byte);
-extern Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm);  // ADC, ADD, AND, CMP, OR, SBB, SUB, XOR
-extern Boolean_t EncodeMov(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm, uint8_t sreg);              // MOV
-extern Boolean_t EncodeShiftRotateBlock(uint8_t mode, uint8_t inst, Register_t regd, Register_t regs, Memory_t mem);                  // RCL, RCR, ROL, ROR, SAL, SAR, SHL, SHR
-extern Boolean_t EncodeTest(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm);                           // TEST
-extern Boolean_t EncodeFarOp(uint8_t mode, uint8_t inst, Memory_t mem, Immediate_t imm1, Immediate_t imm2);                           // JMPF, CALLF
-extern Boolean_t EncodeStackBlock(uint8_t mode, uint8_t inst, Register_t reg, uint8_t sreg, Memory_t mem);                            // POP, PUSH
-extern Boolean_t EncodeNearOp(uint8_t mode, uint8_t inst, Register_t reg, Memory_t mem, Immediate_t imm);                             // JMPN, CALLN
-extern Boolean_t EncodeArithmetic2Block(uint8_t mode, uint8_t inst, Register_t reg, Memory_t mem);                                    // DIV, IDIV, MUL, IMUL, NEG, NOT
-extern Boolean_t EncodeIncDecBlock(uint8_t mode, uint8_t inst, Register_t reg, Memory_t mem);                                         // INC, DEC
-extern Boolean_t EncodeIOBlock(uint8_t mode, uint8_t inst, Register_t reg, Immediate_t imm);                                          // INB, INW, OUTB, OUTW
-extern Boolean_t EncodeXchg(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem);                                            // XCHG
-extern Boolean_t EncodeReturnBlock(uint8_t mode, uint8_t inst, Immediate_t imm);                                                      // RETN, RETF
-extern Boolean_t EncodeAddressBlock(uint8_t inst, Register_t reg, Memory_t mem);                                                      // LEA, LES, LDS
+extern void WriteBytes2File(const uint8_t *buf, size_t len);
+extern void FillPattern(const uint8_t *pat, size_t len, LCounter_t count);  // TIMES, repeat a series
+extern void BeginSegment(size_t seg);                   // Move the output to the start of a segment
+extern long int GetIncbinSize(char *path, long int offset, long int length);    // Size of an INCBIN
+extern void IncludeBinary(char *path, long int offset, long int length);        // Copy an INCBIN file
+extern MCounter_t GetSegmentParagraph(size_t seg);                                  // Value of a segment reference in an executable
+
+/* Relocation Functions */
+extern void ResetReferences(void);                                                  // A segment body starts
+extern int8_t AddReference(uint8_t kind, size_t target, short int val);             // A symbol is used by an operand
+extern int8_t CombineReferences(int8_t left, int8_t right, char op, short int val); // Carry a symbol through an expression
+extern void PlaceReference(int8_t ref, uint8_t field);                              // The operand is not an immediate
+extern void ResolveReferences(Boolean_t isInst);                                    // Relocate the operands of the line
+extern size_t AddExternSymbol(char *name);                                          // Label of another object file
+
+/* Listing Functions */
+extern void ListLine(Boolean_t located);                                            // The line is done, list it with its bytes
+extern Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                              // ADC, ADD, AND, CMP, OR, SBB, SUB, XOR
+extern Boolean_t EncodeMov(uint8_t mode, const Operand_t *op);                                                                        // MOV
+extern Boolean_t EncodeShiftRotateBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                             // RCL, RCR, ROL, ROR, SAL, SAR, SHL, SHR
+extern Boolean_t EncodeTest(uint8_t mode, const Operand_t *op);                                                                       // TEST
+extern Boolean_t EncodeFarOp(uint8_t mode, uint8_t inst, const Operand_t *op);                                                        // JMPF, CALLF
+extern Boolean_t EncodeStackBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                                   // POP, PUSH
+extern Boolean_t EncodeNearOp(uint8_t mode, uint8_t inst, const Operand_t *op);                                                       // JMPN, CALLN
+extern Boolean_t EncodeArithmetic2Block(uint8_t mode, uint8_t inst, const Operand_t *op);                                             // DIV, IDIV, MUL, IMUL, NEG, NOT
+extern Boolean_t EncodeIncDecBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                                  // INC, DEC
+extern Boolean_t EncodeIOBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                                      // INB, INW, OUTB, OUTW
+extern Boolean_t EncodeXchg(uint8_t mode, const Operand_t *op);                                                                       // XCHG
+extern Boolean_t EncodeReturnBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                                  // RETN, RETF
+extern Boolean_t EncodeAddressBlock(uint8_t inst, const Operand_t *op);                                                               // LEA, LES, LDS
 extern Boolean_t EncodeTwoByteInst(uint8_t byte1, uint8_t byte2);
-extern Boolean_t EncodeJccBlock(uint8_t byte1, Immediate_t imm);
+extern Boolean_t EncodeJccBlock(uint8_t byte1, const Operand_t *op);
 extern Boolean_t EncodeSingleByteInst(uint8_t byte);
-extern Boolean_t EncodeInterrupt(Immediate_t imm);                                                                                    // INT
+extern Boolean_t EncodeInterrupt(const Operand_t *op);                                                                                // INT
 extern Boolean_t EncodeEscapeBlock(void);                                                                                             // ESC0-7
+extern Boolean_t EncodeRecord(const IRRecord_t *ir);                                                                                  // Instruction sized by pass 1
+
+/* Instruction IR */
+extern const IRRecord_t *TakeIR(void);                  // Record of the line the scanner replaced
 
 /* Bison/Flex Functions */
 void yyerror(const char *s);                            // Flex/Bison Error Function
@@ -79,6 +106,8 @@ extern int yylex();                                     // Flex Scanner Function
     struct{
         short int val;
         uint8_t   isSym;
+        long int  wide;     // Unchecked value of a NUMBER token
+        int8_t    ref;      // Symbol reference in LineRefs, -1 for a constant
     }imm_t;
 
     struct{
@@ -91,14 +120,23 @@ extern int yylex();                                     // Flex Scanner Function
         uint8_t isSym;
         uint8_t mod;
         uint8_t rm;
+        uint8_t disps;      // Displacement bytes after ModR/M
         short int disp;
     }mem_t;
 
     int   ival;     // Decimal Values
+    long int lval;  // Repeat Counts
+
+    struct{
+        char *path;
+        long int offset;
+        long int length;    // -1 up to the end of the file
+    }bin_t;
     char *sval;     // String  Values
 
     struct{
         size_t szval;
+        size_t cap;
         uint8_t *arr;
     }arr_t;
     size_t szval;
@@ -133,8 +171,9 @@ extern int yylex();                                     // Flex Scanner Function
 %token REG_CL      REG_CX       REG_DH       REG_DI       REG_DL       REG_DX       REG_SI       REG_SP
 %token SREG_CS     SREG_DS      SREG_ES      SREG_SS
 %token SIZE_BYTE   SIZE_DWORD   SIZE_WORD
-%token DIR_PUT     DIR_TIMES    DIR_ORG      DIR_SEGMENT  DIR_HERE
+%token DIR_PUT     DIR_TIMES    DIR_ORG      DIR_SEGMENT  DIR_HERE     DIR_INCBIN
 %token NL
+%token IR_INST      /* A line pass 1 recorded, see IR.c */
 
 %token <sval> LABEL
 %token <sval> SEGNAME
@@ -151,10 +190,12 @@ extern int yylex();                                     // Flex Scanner Function
 %%
 
 init: %empty
-    | init NL                                   { LN++; }
-    | init asmdir NL                            { LN++; }
-    | init asminst NL                           { LN++; }
+    | init NL                                   { ListLine(FALSE); LN++; }
+    | init asmdir NL                            { ResolveReferences(FALSE); ListLine(TRUE); LN++; }
+    | init asminst NL                           { ResolveReferences(TRUE);  ListLine(TRUE); LN++; }
     | init DIR_ORG number NL                    { 
+                                                    ResolveReferences(FALSE);
+                                                    ListLine(FALSE);
                                                     if(isORG == NSET){
                                                         LC = $<imm_t.val>3;
                                                     }else{
@@ -163,7 +204,8 @@ init: %empty
                                                     }
                                                     LN++; 
                                                 }
-    | init DIR_SEGMENT SEGNAME '{' init '}'     { LC += SegmentTable[stsize-1].LC; }
+    | init DIR_SEGMENT SEGNAME '{'              { BeginSegment(CurrentSegment); ResetReferences(); }
+                               init '}'         { LC += SegmentTable[CurrentSegment].LC; }
     | init DIR_SEGMENT error    { printf("Error in Segment\n"); }
     | init LABEL ':' NL                         { 
                                                     size_t tmp = CheckLabelExistence($<sval>2);
@@ -171,57 +213,84 @@ init: %empty
                                                         PrintError(COLOR_BOLDRED, "Line %d :: Label Registration Error!\n", LN);
                                                         ExitSafely(EXIT_FAILURE);
                                                     }
+                                                    ListLine(TRUE);
                                                     LN++; 
                                                 }
 ;
 
 asmdir: DIR_PUT series                          {
-                                                    SegmentTable[stsize-1].LC += $<arr_t.szval>2;
-                                                    size_t sz = $<arr_t.szval>2;
-                                                    size_t idx;
-                                                    for(idx=0; idx<sz; idx++)
-                                                        WriteByte2File($<arr_t.arr[idx]>2);
-                                                }
-      | DIR_TIMES number DIR_PUT series         {
-                                                    SegmentTable[stsize-1].LC += $<imm_t.val>2 * $<arr_t.szval>4;
+                                                    SegmentTable[CurrentSegment].LC += $<arr_t.szval>2;
+                                                    WriteBytes2File($<arr_t.arr>2, $<arr_t.szval>2);
+                                                    free($<arr_t.arr>2);
+                                                }
+      | DIR_TIMES count DIR_PUT series          {
+                                                    long int count = $<lval>2;
                                                     size_t sz = $<arr_t.szval>4;
-                                                    size_t idx;
-                                                    short int repeat = $<imm_t.val>2;
-                                                    short int t;
-                                                    for(t=0; t<repeat; t++){
-                                                        for(idx=0; idx<sz; idx++){
-                                                            WriteByte2File($<arr_t.arr[idx]>4);
-                                                        }
+                                                    if( (count < 0) || (count * sz > SEGMENT_MAX) ){
+                                                        PrintError(COLOR_BOLDRED, "Line %d :: TIMES count does not fit into the segment!\n", LN);
+                                                        ExitSafely(EXIT_FAILURE);
+                                                    }
+                                                    SegmentTable[CurrentSegment].LC += count * sz;
+                                                    FillPattern($<arr_t.arr>4, sz, count);
+                                                    free($<arr_t.arr>4);
+                                                }
+      | incbin                                  {
+                                                    long int size = GetIncbinSize($<bin_t.path>1, $<bin_t.offset>1, $<bin_t.length>1);
+                                                    if(size < 0)
+                                                        ExitSafely(EXIT_FAILURE);
+                                                    SegmentTable[CurrentSegment].LC += size;
+                                                    IncludeBinary($<bin_t.path>1, $<bin_t.offset>1, size);
+                                                }
+;
+
+/* INCBIN "file" [, offset [, length]] */
+incbin: DIR_INCBIN STRCONST                     { $<bin_t.path>$ = $<sval>2; $<bin_t.offset>$ = 0;           $<bin_t.length>$ = -1; }
+      | DIR_INCBIN STRCONST ',' count           { $<bin_t.path>$ = $<sval>2; $<bin_t.offset>$ = $<lval>4;    $<bin_t.length>$ = -1; }
+      | DIR_INCBIN STRCONST ',' count ',' count {
+                                                    $<bin_t.path>$ = $<sval>2; $<bin_t.offset>$ = $<lval>4;
+                                                    $<bin_t.length>$ = $<lval>6;
+                                                    if($<lval>6 < 0){
+                                                        PrintError(COLOR_BOLDRED, "Line %d :: INCBIN length is negative!\n", LN);
+                                                        ExitSafely(EXIT_FAILURE);
                                                     }
                                                 }
 ;
 series: number              {
-                                uint8_t *tmp = malloc(sizeof(uint8_t));
+                                uint8_t *tmp = malloc(SERIES_INITCAP*sizeof(uint8_t));
                                 tmp[0] = Convert2UnsignedByte($<imm_t.val>1);
                                 $<arr_t.szval>$ = 1;
+                                $<arr_t.cap>$ = SERIES_INITCAP;
                                 $<arr_t.arr>$ = tmp;
                             }
       | STRCONST            {
-                                char *s = strdup($<sval>1);
-                                size_t sz = strlen(s);
+                                size_t sz = strlen($<sval>1);
+                                size_t cap = (sz > SERIES_INITCAP) ? sz : SERIES_INITCAP;
+                                uint8_t *tmp = malloc(cap*sizeof(uint8_t));
+                                memcpy(tmp, $<sval>1, sz);
                                 $<arr_t.szval>$ = sz;
-                                uint8_t *tmp = malloc(sz*sizeof(uint8_t));
-                                size_t idx;
-                                for(idx=0; idx<sz; idx++)
-                                    tmp[idx] = (uint8_t) s[idx];
+                                $<arr_t.cap>$ = cap;
                                 $<arr_t.arr>$ = tmp;
                             }
       | series ',' series   {
+                                // ',' is left associative, the left series keeps growing
                                 size_t sz1 = $<arr_t.szval>1;
                                 size_t sz2 = $<arr_t.szval>3;
-                                uint8_t *tmp = malloc( (sz1+sz2)*sizeof(uint8_t) );
-                                size_t idx;
-                                for(idx=0; idx<sz1; idx++)
-                                    tmp[idx] = $<arr_t.arr[idx]>1;
-                                for(; idx<(sz1+sz2); idx++)
-                                    tmp[idx] = $<arr_t.arr[idx - sz1]>3;
-                                
+                                size_t cap = $<arr_t.cap>1;
+                                uint8_t *tmp = $<arr_t.arr>1;
+                                if(sz1+sz2 > cap){
+                                    while(sz1+sz2 > cap)
+                                        cap <<= 1;
+                                    tmp = realloc(tmp, cap*sizeof(uint8_t));
+                                    if(!tmp){
+                                        ExternalError("Failed to allocate data series: ");
+                                        ExitSafely(EXIT_FAILURE);
+                                    }
+                                }
+                                memcpy(tmp+sz1, $<arr_t.arr>3, sz2);
+                                free($<arr_t.arr>3);
+
                                 $<arr_t.szval>$ = (sz1+sz2);
+                                $<arr_t.cap>$ = cap;
                                 $<arr_t.arr>$ = tmp;
                             }
 ;
@@ -231,6 +300,10 @@ asminst: INST_SEG sreg                      {
                                                 SOP = $<ival>2;
                                                 isSOP = SET;
                                             }
+       | IR_INST                            {
+                                                Boolean_t ret = EncodeRecord(TakeIR());
+                                                if(ret == FALSE) erroneous = TRUE;
+                                            }
        | data_transfer
        | arithmetic
        | bit_manipulation
@@ -240,158 +313,158 @@ asminst: INST_SEG sreg                      {
        | error
 ;
 data_transfer: INST_MOV   reg  ',' reg      {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg = 0;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                 
-                                                Boolean_t ret = EncodeMov(MODE_REG_REG, regd, regs, mem, imm, sreg);
+                                                Boolean_t ret = EncodeMov(MODE_REG_REG, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_MOV   reg  ',' mem      {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg = 0;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
 
-                                                Boolean_t ret = EncodeMov(MODE_REG_MEM, regd, regs, mem, imm, sreg);
+                                                Boolean_t ret = EncodeMov(MODE_REG_MEM, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_MOV   mem  ',' reg      {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg = 0;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                 
-                                                Boolean_t ret = EncodeMov(MODE_MEM_REG, regd, regs, mem, imm, sreg);
+                                                Boolean_t ret = EncodeMov(MODE_MEM_REG, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_MOV   reg  ',' number   {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg = 0;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else{
                                                     erroneous = TRUE;
-                                                    imm.size = SZ_ERR;
+                                                    op[1].size = SZ_ERR;
                                                 }
                                                 
-                                                Boolean_t ret = EncodeMov(MODE_REG_IMM, regd, regs, mem, imm, sreg);
+                                                Boolean_t ret = EncodeMov(MODE_REG_IMM, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_MOV   mem  ',' number   {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg = 0;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                Boolean_t ret = EncodeMov(MODE_MEM_IMM, regd, regs, mem, imm, sreg);
+                                                Boolean_t ret = EncodeMov(MODE_MEM_IMM, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_MOV   sreg ',' reg      {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg;
-                                                sreg = $<ival>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_SREG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<ival>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                Boolean_t ret = EncodeMov(MODE_SREG_REG, regd, regs, mem, imm, sreg);
+                                                Boolean_t ret = EncodeMov(MODE_SREG_REG, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_MOV   sreg ',' mem      {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg;
-                                                sreg = $<ival>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_SREG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<ival>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
 
-                                                Boolean_t ret = EncodeMov(MODE_SREG_MEM, regd, regs, mem, imm, sreg);
+                                                Boolean_t ret = EncodeMov(MODE_SREG_MEM, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_MOV   reg  ',' sreg     {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg;
-                                                sreg = $<ival>4;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_SREG } };
+                                                op[1].id = $<ival>4;
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeMov(MODE_REG_SREG, regd, regs, mem, imm, sreg);
+                                                Boolean_t ret = EncodeMov(MODE_REG_SREG, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_MOV   mem  ',' sreg     {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm; uint8_t sreg;
-                                                sreg = $<ival>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_SREG } };
+                                                op[1].id = $<ival>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                Boolean_t ret = EncodeMov(MODE_MEM_SREG, regd, regs, mem, imm, sreg);
+                                                Boolean_t ret = EncodeMov(MODE_MEM_SREG, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
              | INST_PUSH  reg               {
-                                                Register_t reg; Memory_t mem; uint8_t sreg=0;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeStackBlock(MODE_REG, PUSH_INST, reg, sreg, mem);
+                                                Boolean_t ret = EncodeStackBlock(MODE_REG, PUSH_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_PUSH  sreg              {
-                                                Register_t reg; Memory_t mem; uint8_t sreg;
-                                                sreg = $<ival>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_SREG } };
+                                                op[0].id = $<ival>2;
 
-                                                Boolean_t ret = EncodeStackBlock(MODE_SREG, PUSH_INST, reg, sreg, mem);
+                                                Boolean_t ret = EncodeStackBlock(MODE_SREG, PUSH_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_PUSH  mem               {
-                                                Register_t reg; Memory_t mem; uint8_t sreg = 0;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                Boolean_t ret = EncodeStackBlock(MODE_MEM, PUSH_INST, reg, sreg, mem);
+                                                Boolean_t ret = EncodeStackBlock(MODE_MEM, PUSH_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
              | INST_POP   reg               {
-                                                Register_t reg; Memory_t mem; uint8_t sreg=0;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeStackBlock(MODE_REG, POP_INST, reg, sreg, mem);
+                                                Boolean_t ret = EncodeStackBlock(MODE_REG, POP_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_POP   sreg              {
-                                                Register_t reg; Memory_t mem; uint8_t sreg;
-                                                sreg = $<ival>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_SREG } };
+                                                op[0].id = $<ival>2;
 
-                                                Boolean_t ret = EncodeStackBlock(MODE_SREG, POP_INST, reg, sreg, mem);
+                                                Boolean_t ret = EncodeStackBlock(MODE_SREG, POP_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_POP   mem               {
-                                                Register_t reg; Memory_t mem; uint8_t sreg = 0;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                Boolean_t ret = EncodeStackBlock(MODE_MEM, POP_INST, reg, sreg, mem);
+                                                Boolean_t ret = EncodeStackBlock(MODE_MEM, POP_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
              | INST_XCHG  reg ',' reg       {
-                                                Register_t regd, regs; Memory_t mem;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                Boolean_t ret = EncodeXchg(MODE_REG_REG, regd, regs, mem);
+                                                Boolean_t ret = EncodeXchg(MODE_REG_REG, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_XCHG  mem ',' reg       {
-                                                Register_t regd, regs; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                 
-                                                Boolean_t ret = EncodeXchg(MODE_MEM_REG, regd, regs, mem);
+                                                Boolean_t ret = EncodeXchg(MODE_MEM_REG, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
@@ -401,112 +474,112 @@ data_transfer: INST_MOV   reg  ',' reg      {
                                             }
 
              | INST_INB   number            {
-                                                Register_t reg; Immediate_t imm;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                 uint8_t sz = CalculateSize($<imm_t.val>2);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>2;
-                                                    imm.val = $<imm_t.val>2;
+                                                    op[0].size = sz;
+                                                    op[0].isSym = $<imm_t.isSym>2;
+                                                    op[0].val = $<imm_t.val>2;
                                                 }else
                                                     erroneous = TRUE;
                                                 
-                                                Boolean_t ret = EncodeIOBlock(MODE_IMM, INB_INST, reg, imm);
+                                                Boolean_t ret = EncodeIOBlock(MODE_IMM, INB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_INB   reg               {
-                                                Register_t reg; Immediate_t imm;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeIOBlock(MODE_REG, INB_INST, reg, imm);
+                                                Boolean_t ret = EncodeIOBlock(MODE_REG, INB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_INW   number            {
-                                                Register_t reg; Immediate_t imm;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                 uint8_t sz = CalculateSize($<imm_t.val>2);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>2;
-                                                    imm.val = $<imm_t.val>2;
+                                                    op[0].size = sz;
+                                                    op[0].isSym = $<imm_t.isSym>2;
+                                                    op[0].val = $<imm_t.val>2;
                                                 }else
                                                     erroneous = TRUE;
                                                 
-                                                Boolean_t ret = EncodeIOBlock(MODE_IMM, INW_INST, reg, imm);
+                                                Boolean_t ret = EncodeIOBlock(MODE_IMM, INW_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_INW   reg               {
-                                                Register_t reg; Immediate_t imm;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeIOBlock(MODE_REG, INW_INST, reg, imm);
+                                                Boolean_t ret = EncodeIOBlock(MODE_REG, INW_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
              | INST_OUTB   number           {
-                                                Register_t reg; Immediate_t imm;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                 uint8_t sz = CalculateSize($<imm_t.val>2);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>2;
-                                                    imm.val = $<imm_t.val>2;
+                                                    op[0].size = sz;
+                                                    op[0].isSym = $<imm_t.isSym>2;
+                                                    op[0].val = $<imm_t.val>2;
                                                 }else
                                                     erroneous = TRUE;
                                                 
-                                                Boolean_t ret = EncodeIOBlock(MODE_IMM, OUTB_INST, reg, imm);
+                                                Boolean_t ret = EncodeIOBlock(MODE_IMM, OUTB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_OUTB   reg              {
-                                                Register_t reg; Immediate_t imm;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeIOBlock(MODE_REG, OUTB_INST, reg, imm);
+                                                Boolean_t ret = EncodeIOBlock(MODE_REG, OUTB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_OUTW   number           {
-                                                Register_t reg; Immediate_t imm;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                 uint8_t sz = CalculateSize($<imm_t.val>2);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>2;
-                                                    imm.val = $<imm_t.val>2;
+                                                    op[0].size = sz;
+                                                    op[0].isSym = $<imm_t.isSym>2;
+                                                    op[0].val = $<imm_t.val>2;
                                                 }else
                                                     erroneous = TRUE;
                                                 
-                                                Boolean_t ret = EncodeIOBlock(MODE_IMM, OUTW_INST, reg, imm);
+                                                Boolean_t ret = EncodeIOBlock(MODE_IMM, OUTW_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_OUTW   reg              {
-                                                Register_t reg; Immediate_t imm;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeIOBlock(MODE_REG, OUTW_INST, reg, imm);
+                                                Boolean_t ret = EncodeIOBlock(MODE_REG, OUTW_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
              | INST_LEA   reg ',' mem       {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
 
-                                                Boolean_t ret = EncodeAddressBlock(LEA_INST,  reg, mem);
+                                                Boolean_t ret = EncodeAddressBlock(LEA_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_LDS   reg ',' mem       {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
 
-                                                Boolean_t ret = EncodeAddressBlock(LDS_INST,  reg, mem);
+                                                Boolean_t ret = EncodeAddressBlock(LDS_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
              | INST_LES   reg ',' mem       {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
 
-                                                Boolean_t ret = EncodeAddressBlock(LES_INST,  reg, mem);
+                                                Boolean_t ret = EncodeAddressBlock(LES_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
@@ -528,131 +601,131 @@ data_transfer: INST_MOV   reg  ',' reg      {
                                             }
 ;
 arithmetic: INST_ADD  reg ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, ADD_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, ADD_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_ADD  reg ',' mem           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, ADD_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, ADD_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_ADD  mem ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, ADD_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, ADD_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_ADD  reg ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, ADD_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, ADD_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_ADD  mem ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, ADD_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, ADD_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
           | INST_ADC  reg ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, ADC_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, ADC_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_ADC  reg ',' mem           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, ADC_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, ADC_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_ADC  mem ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, ADC_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, ADC_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_ADC  reg ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, ADC_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, ADC_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_ADC  mem ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, ADC_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, ADC_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
           | INST_INC  reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeIncDecBlock(MODE_REG, INC_INST, reg, mem);
+                                                Boolean_t ret = EncodeIncDecBlock(MODE_REG, INC_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_INC  mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                Boolean_t ret = EncodeIncDecBlock(MODE_MEM, INC_INST, reg, mem);
+                                                Boolean_t ret = EncodeIncDecBlock(MODE_MEM, INC_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
@@ -666,202 +739,202 @@ arithmetic: INST_ADD  reg ',' reg           {
                                             }
 
           | INST_SUB  reg ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, SUB_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, SUB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_SUB  reg ',' mem           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, SUB_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, SUB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_SUB  mem ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, SUB_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, SUB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_SUB  reg ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, SUB_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, SUB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_SUB  mem ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, SUB_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, SUB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
           | INST_SBB  reg ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, SBB_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, SBB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_SBB  reg ',' mem           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, SBB_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, SBB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_SBB  mem ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, SBB_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, SBB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_SBB  reg ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, SBB_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, SBB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_SBB  mem ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, SBB_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, SBB_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
           | INST_DEC  reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeIncDecBlock(MODE_REG, DEC_INST, reg, mem);
+                                                Boolean_t ret = EncodeIncDecBlock(MODE_REG, DEC_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_DEC  mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                Boolean_t ret = EncodeIncDecBlock(MODE_MEM, DEC_INST, reg, mem);
+                                                Boolean_t ret = EncodeIncDecBlock(MODE_MEM, DEC_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
           | INST_NEG  reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeArithmetic2Block(MODE_REG, NEG_INST, reg, mem);
+                                                Boolean_t ret = EncodeArithmetic2Block(MODE_REG, NEG_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_NEG  mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, NEG_INST, reg, mem);
+                                                Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, NEG_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
           | INST_CMP  reg ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, CMP_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, CMP_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_CMP  reg ',' mem           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, CMP_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, CMP_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_CMP  mem ',' reg           {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, CMP_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, CMP_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_CMP  reg ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, CMP_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, CMP_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_CMP  mem ',' number        {
-                                                Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                 uint8_t sz = CalculateSize($<imm_t.val>4);
                                                 if(sz != SZ_ERR){
-                                                    imm.size = sz;
-                                                    imm.isSym = $<imm_t.isSym>4;
-                                                    imm.val = $<imm_t.val>4;
+                                                    op[1].size = sz;
+                                                    op[1].isSym = $<imm_t.isSym>4;
+                                                    op[1].val = $<imm_t.val>4;
                                                 }else
                                                     erroneous = TRUE;
 
-                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, CMP_INST, regd, regs, mem, imm);
+                                                Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, CMP_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
@@ -875,34 +948,34 @@ arithmetic: INST_ADD  reg ',' reg           {
                                             }
 
           | INST_MUL  reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeArithmetic2Block(MODE_REG, MUL_INST, reg, mem);
+                                                Boolean_t ret = EncodeArithmetic2Block(MODE_REG, MUL_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_MUL  mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, MUL_INST, reg, mem);
+                                                Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, MUL_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
           | INST_IMUL reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeArithmetic2Block(MODE_REG, IMUL_INST, reg, mem);
+                                                Boolean_t ret = EncodeArithmetic2Block(MODE_REG, IMUL_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_IMUL mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, IMUL_INST, reg, mem);
+                                                Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, IMUL_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
@@ -912,34 +985,34 @@ arithmetic: INST_ADD  reg ',' reg           {
                                             }
 
           | INST_DIV  reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeArithmetic2Block(MODE_REG, DIV_INST, reg, mem);
+                                                Boolean_t ret = EncodeArithmetic2Block(MODE_REG, DIV_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_DIV  mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, DIV_INST, reg, mem);
+                                                Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, DIV_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
           | INST_IDIV reg                   {
-                                                Register_t reg; Memory_t mem;
-                                                reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                Boolean_t ret = EncodeArithmetic2Block(MODE_REG, IDIV_INST, reg, mem);
+                                                Boolean_t ret = EncodeArithmetic2Block(MODE_REG, IDIV_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
           | INST_IDIV mem                   {
-                                                Register_t reg; Memory_t mem;
-                                                mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, IDIV_INST, reg, mem);
+                                                Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, IDIV_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                             }
 
@@ -957,497 +1030,497 @@ arithmetic: INST_ADD  reg ',' reg           {
                                             }
 ;
 bit_manipulation: INST_NOT  reg                 {
-                                                    Register_t reg; Memory_t mem;
-                                                    reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    Boolean_t ret = EncodeArithmetic2Block(MODE_REG, NOT_INST, reg, mem);
+                                                    Boolean_t ret = EncodeArithmetic2Block(MODE_REG, NOT_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_NOT  mem                 {
-                                                    Register_t reg; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, NOT_INST, reg, mem);
+                                                    Boolean_t ret = EncodeArithmetic2Block(MODE_MEM, NOT_INST, op);
                                                 if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_AND  reg ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, AND_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, AND_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_AND  reg ',' mem         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                    mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                    op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
                                                     
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, AND_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, AND_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_AND  mem ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                     
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, AND_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, AND_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_AND  reg ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
                                                 
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, AND_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, AND_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_AND  mem ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
 
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, AND_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, AND_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_OR   reg ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, OR_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, OR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_OR   reg ',' mem         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                    mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                    op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
                                                     
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, OR_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, OR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_OR   mem ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                     
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, OR_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, OR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_OR   reg ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
                                                 
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, OR_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, OR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_OR   mem ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
 
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, OR_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, OR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_XOR  reg ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, XOR_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_REG, XOR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_XOR  reg ',' mem         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                    mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                    op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
                                                     
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, XOR_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_MEM, XOR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_XOR  mem ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>4; regd.size = $<reg_t.size>4;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                     
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, XOR_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_REG, XOR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_XOR  reg ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
                                                 
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, XOR_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_REG_IMM, XOR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_XOR  mem ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
 
-                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, XOR_INST, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeArithmeticBlock(MODE_MEM_IMM, XOR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_TEST reg ',' reg         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    Boolean_t ret = EncodeTest(MODE_REG_REG, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeTest(MODE_REG_REG, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_TEST reg ',' mem         {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    mem.size = $<mem_t.size>4; mem.isSym = $<mem_t.isSym>4; mem.disp = $<mem_t.disp>4;
-                                                    mem.mod = $<mem_t.mod>4; mem.rm = $<mem_t.rm>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_MEM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].size = $<mem_t.size>4; op[1].isSym = $<mem_t.isSym>4; op[1].val = $<mem_t.disp>4;
+                                                    op[1].mod = $<mem_t.mod>4; op[1].rm = $<mem_t.rm>4; op[1].disps = $<mem_t.disps>4;
                                                     
-                                                    Boolean_t ret = EncodeTest(MODE_REG_MEM, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeTest(MODE_REG_MEM, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_TEST reg ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_IMM } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
                                                 
-                                                    Boolean_t ret = EncodeTest(MODE_REG_IMM, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeTest(MODE_REG_IMM, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_TEST mem ',' number      {
-                                                    Register_t regd, regs; Memory_t mem; Immediate_t imm;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_IMM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                     uint8_t sz = CalculateSize($<imm_t.val>4);
                                                     if(sz != SZ_ERR){
-                                                        imm.size = sz;
-                                                        imm.isSym = $<imm_t.isSym>4;
-                                                        imm.val = $<imm_t.val>4;
+                                                        op[1].size = sz;
+                                                        op[1].isSym = $<imm_t.isSym>4;
+                                                        op[1].val = $<imm_t.val>4;
                                                     }else
                                                         erroneous = TRUE;
 
-                                                    Boolean_t ret = EncodeTest(MODE_MEM_IMM, regd, regs, mem, imm);
+                                                    Boolean_t ret = EncodeTest(MODE_MEM_IMM, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_SHL reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, SHL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, SHL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SHL reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, SHL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, SHL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SHL mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, SHL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, SHL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SHL mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, SHL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, SHL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_SAL reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, SAL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, SAL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SAL reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, SAL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, SAL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SAL mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, SAL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, SAL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SAL mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, SAL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, SAL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_SHR reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, SHR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, SHR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SHR reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, SHR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, SHR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SHR mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, SHR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, SHR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SHR mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, SHR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, SHR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_SAR reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, SAR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, SAR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SAR reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, SAR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, SAR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SAR mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, SAR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, SAR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_SAR mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, SAR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, SAR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_ROL reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, ROL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, ROL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_ROL reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, ROL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, ROL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_ROL mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, ROL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, ROL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_ROL mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, ROL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, ROL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_ROR reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, ROR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, ROR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_ROR reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, ROR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, ROR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_ROR mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, ROR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, ROR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_ROR mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, ROR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, ROR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_RCL reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, RCL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, RCL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_RCL reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, RCL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, RCL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_RCL mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, RCL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, RCL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_RCL mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, RCL_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, RCL_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 
                 | INST_RCR reg                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, RCR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG, RCR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_RCR reg ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    regd.id = $<reg_t.id>2; regd.size = $<reg_t.size>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG }, { .kind = OPERAND_REG } };
+                                                    op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
                                                     
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, RCR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_REG_REG, RCR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_RCR mem                  {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, RCR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM, RCR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
                 | INST_RCR mem ',' reg          {
-                                                    Register_t regd, regs; Memory_t mem;
-                                                    mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                    mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
-                                                    regs.id = $<reg_t.id>4; regs.size = $<reg_t.size>4;
+                                                    Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM }, { .kind = OPERAND_REG } };
+                                                    op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                    op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
+                                                    op[1].id = $<reg_t.id>4; op[1].size = $<reg_t.size>4;
 
-                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, RCR_INST, regd, regs, mem);
+                                                    Boolean_t ret = EncodeShiftRotateBlock(MODE_MEM_REG, RCR_INST, op);
                                                     if(ret == FALSE) erroneous = TRUE;
                                                 }
 ;
@@ -1513,439 +1586,439 @@ string_operation: INST_REP                      {
                                                 }
 ;
 program_transfer: INST_CALLF  number ':' number     {
-                                                        Memory_t mem; Immediate_t imm1, imm2;
-                                                        imm1.size = SZ_WORD; imm1.isSym = $<imm_t.isSym>2; imm1.val = $<imm_t.val>2;
-                                                        imm2.size = SZ_WORD; imm2.isSym = $<imm_t.isSym>4; imm2.val = $<imm_t.val>4;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM }, { .kind = OPERAND_IMM } };
+                                                        PlaceReference($<imm_t.ref>2, FIELD_SEG);
+                                                        op[0].size = SZ_WORD; op[0].isSym = $<imm_t.isSym>2; op[0].val = $<imm_t.val>2;
+                                                        op[1].size = SZ_WORD; op[1].isSym = $<imm_t.isSym>4; op[1].val = $<imm_t.val>4;
 
-                                                        Boolean_t ret = EncodeFarOp(MODE_IMM_IMM, CALLF_INST, mem, imm1, imm2);
+                                                        Boolean_t ret = EncodeFarOp(MODE_IMM_IMM, CALLF_INST, op);
                                                         if(ret == TRUE) erroneous = TRUE;
                                                     }
                 | INST_CALLF  mem                   {
-                                                        Memory_t mem; Immediate_t imm1, imm2;
-                                                        mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                        mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                        op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                        op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                        Boolean_t ret = EncodeFarOp(MODE_MEM, CALLF_INST, mem, imm1, imm2);
+                                                        Boolean_t ret = EncodeFarOp(MODE_MEM, CALLF_INST, op);
                                                         if(ret == TRUE) erroneous = TRUE;
                                                     }
 
                 | INST_CALLN  number                {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                         uint8_t sz = CalculateSize($<imm_t.val>2);
                                                         if(sz != SZ_ERR){
-                                                            imm.size = sz;
-                                                            imm.isSym = $<imm_t.isSym>2;
-                                                            imm.val = $<imm_t.val>2;
+                                                            op[0].size = sz;
+                                                            op[0].isSym = $<imm_t.isSym>2;
+                                                            op[0].val = $<imm_t.val>2;
                                                         }else
                                                             erroneous = TRUE;
                                                         
-                                                        Boolean_t ret = EncodeNearOp(MODE_IMM, CALLN_INST, reg, mem, imm);
+                                                        Boolean_t ret = EncodeNearOp(MODE_IMM, CALLN_INST, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_CALLN  reg                   {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
-                                                        reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                        op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
 
-                                                        Boolean_t ret = EncodeNearOp(MODE_REG, CALLN_INST, reg, mem, imm);
+                                                        Boolean_t ret = EncodeNearOp(MODE_REG, CALLN_INST, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_CALLN  mem                   {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
-                                                        mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                        mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                        op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                        op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                         
-                                                        Boolean_t ret = EncodeNearOp(MODE_MEM, CALLN_INST, reg, mem, imm);
+                                                        Boolean_t ret = EncodeNearOp(MODE_MEM, CALLN_INST, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
 
                 | INST_RETN                         {
-                                                        Immediate_t imm;
-                                                        
-                                                        Boolean_t ret = EncodeReturnBlock(MODE_NO_OPERAND, RETN_INST, imm);
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_NONE } };
+                                                        Boolean_t ret = EncodeReturnBlock(MODE_NO_OPERAND, RETN_INST, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_RETN  number                 {
-                                                        Immediate_t imm;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                         uint8_t sz = CalculateSize($<imm_t.val>2);
                                                         if(sz != SZ_ERR){
-                                                            imm.size = sz;
-                                                            imm.isSym = $<imm_t.isSym>2;
-                                                            imm.val = $<imm_t.val>2;
+                                                            op[0].size = sz;
+                                                            op[0].isSym = $<imm_t.isSym>2;
+                                                            op[0].val = $<imm_t.val>2;
                                                         }else
                                                             erroneous = TRUE;
                                                         
-                                                        Boolean_t ret = EncodeReturnBlock(MODE_IMM, RETN_INST, imm);
+                                                        Boolean_t ret = EncodeReturnBlock(MODE_IMM, RETN_INST, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
 
                 | INST_RETF                         {
-                                                        Immediate_t imm;
-                                                        
-                                                        Boolean_t ret = EncodeReturnBlock(MODE_NO_OPERAND, RETF_INST, imm);
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_NONE } };
+                                                        Boolean_t ret = EncodeReturnBlock(MODE_NO_OPERAND, RETF_INST, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_RETF  number                 {
-                                                        Immediate_t imm;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                         uint8_t sz = CalculateSize($<imm_t.val>2);
                                                         if(sz != SZ_ERR){
-                                                            imm.size = sz;
-                                                            imm.isSym = $<imm_t.isSym>2;
-                                                            imm.val = $<imm_t.val>2;
+                                                            op[0].size = sz;
+                                                            op[0].isSym = $<imm_t.isSym>2;
+                                                            op[0].val = $<imm_t.val>2;
                                                         }else
                                                             erroneous = TRUE;
                                                         
-                                                        Boolean_t ret = EncodeReturnBlock(MODE_IMM, RETF_INST, imm);
+                                                        Boolean_t ret = EncodeReturnBlock(MODE_IMM, RETF_INST, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
 
                 | INST_JMPF  number ':' number      {
-                                                        Memory_t mem; Immediate_t imm1, imm2;
-                                                        imm1.size = SZ_WORD; imm1.isSym = $<imm_t.isSym>2; imm1.val = $<imm_t.val>2;
-                                                        imm2.size = SZ_WORD; imm2.isSym = $<imm_t.isSym>4; imm2.val = $<imm_t.val>4;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM }, { .kind = OPERAND_IMM } };
+                                                        PlaceReference($<imm_t.ref>2, FIELD_SEG);
+                                                        op[0].size = SZ_WORD; op[0].isSym = $<imm_t.isSym>2; op[0].val = $<imm_t.val>2;
+                                                        op[1].size = SZ_WORD; op[1].isSym = $<imm_t.isSym>4; op[1].val = $<imm_t.val>4;
 
-                                                        Boolean_t ret = EncodeFarOp(MODE_IMM_IMM, JMPF_INST, mem, imm1, imm2);
+                                                        Boolean_t ret = EncodeFarOp(MODE_IMM_IMM, JMPF_INST, op);
                                                         if(ret == TRUE) erroneous = TRUE;
                                                     }
                 | INST_JMPF  mem                    {
-                                                        Memory_t mem; Immediate_t imm1, imm2;
-                                                        mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                        mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                        op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                        op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
 
-                                                        Boolean_t ret = EncodeFarOp(MODE_MEM, JMPF_INST, mem, imm1, imm2);
+                                                        Boolean_t ret = EncodeFarOp(MODE_MEM, JMPF_INST, op);
                                                         if(ret == TRUE) erroneous = TRUE;
                                                     }
 
                 | INST_JMPN  number                 {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                         uint8_t sz = CalculateSize($<imm_t.val>2);
                                                         if(sz != SZ_ERR){
-                                                            imm.size = sz;
-                                                            imm.isSym = $<imm_t.isSym>2;
-                                                            imm.val = $<imm_t.val>2;
+                                                            op[0].size = sz;
+                                                            op[0].isSym = $<imm_t.isSym>2;
+                                                            op[0].val = $<imm_t.val>2;
                                                         }else
                                                             erroneous = TRUE;
                                                         
-                                                        Boolean_t ret = EncodeNearOp(MODE_IMM, JMPN_INST, reg, mem, imm);
+                                                        Boolean_t ret = EncodeNearOp(MODE_IMM, JMPN_INST, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JMPN  reg                    {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
-                                                        reg.id = $<reg_t.id>2; reg.size = $<reg_t.size>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_REG } };
+                                                        op[0].id = $<reg_t.id>2; op[0].size = $<reg_t.size>2;
                                                         
-                                                        Boolean_t ret = EncodeNearOp(MODE_REG, JMPN_INST, reg, mem, imm);
+                                                        Boolean_t ret = EncodeNearOp(MODE_REG, JMPN_INST, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JMPN  mem                    {
-                                                        Register_t reg; Memory_t mem; Immediate_t imm;
-                                                        mem.size = $<mem_t.size>2; mem.isSym = $<mem_t.isSym>2; mem.disp = $<mem_t.disp>2;
-                                                        mem.mod = $<mem_t.mod>2; mem.rm = $<mem_t.rm>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_MEM } };
+                                                        op[0].size = $<mem_t.size>2; op[0].isSym = $<mem_t.isSym>2; op[0].val = $<mem_t.disp>2;
+                                                        op[0].mod = $<mem_t.mod>2; op[0].rm = $<mem_t.rm>2; op[0].disps = $<mem_t.disps>2;
                                                         
-                                                        Boolean_t ret = EncodeNearOp(MODE_MEM, JMPN_INST, reg, mem, imm);
+                                                        Boolean_t ret = EncodeNearOp(MODE_MEM, JMPN_INST, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
 
                 | INST_JA    number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x77, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x77, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNBE  number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x76, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x76, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JAE   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x73, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x73, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNB   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x73, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x73, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JB    number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x72, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x72, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNAE  number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x72, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x72, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JBE   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x76, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x76, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNA   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x76, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x76, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JC    number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x72, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x72, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JE    number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x74, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x74, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JZ    number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x74, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x74, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JG    number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7F, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7F, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNLE  number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7F, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7F, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JGE   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7D, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7D, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNL   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7D, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7D, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JL    number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7C, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7C, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNGE  number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7C, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7C, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JLE   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7E, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7E, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNG   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7E, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7E, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNC   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x73, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x73, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNE   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x75, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x75, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNZ   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x75, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x75, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNO   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x71, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x71, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNP   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x73, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x73, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JPO   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x73, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x73, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JNS   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x71, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x71, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JO    number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x70, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x70, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JP    number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7A, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7A, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JPE   number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7A, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x7A, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_JS    number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x78, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0x78, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
 
                 | INST_LOOP    number               {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE2, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE2, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_LOOPE   number               {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE1, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE1, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_LOOPNE  number               {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE0, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE0, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_LOOPNZ  number               {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE0, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE0, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
                 | INST_LOOPZ   number               {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE1, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE1, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
 
                 | INST_JCXZ  number                 {
-                                                        Immediate_t imm;
-                                                        imm.isSym = $<imm_t.isSym>2; imm.size = CalculateSize($<imm_t.val>2);
-                                                        imm.val = $<imm_t.val>2;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
+                                                        op[0].isSym = $<imm_t.isSym>2; op[0].size = CalculateSize($<imm_t.val>2);
+                                                        op[0].val = $<imm_t.val>2;
 
-                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE3, imm);
+                                                        Boolean_t ret = EncodeJccBlock((uint8_t) 0xE3, op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
 
                 | INST_INT   number                 {
-                                                        Immediate_t imm;
+                                                        Operand_t op[OPERANDS_MAX] = { { .kind = OPERAND_IMM } };
                                                         uint8_t sz = CalculateSize($<imm_t.val>2);
                                                         if(sz != SZ_ERR){
-                                                            imm.size = sz;
-                                                            imm.isSym = $<imm_t.isSym>2;
-                                                            imm.val = $<imm_t.val>2;
+                                                            op[0].size = sz;
+                                                            op[0].isSym = $<imm_t.isSym>2;
+                                                            op[0].val = $<imm_t.val>2;
                                                         }else
                                                             erroneous = TRUE;
                                                         
-                                                        Boolean_t ret = EncodeInterrupt(imm);
+                                                        Boolean_t ret = EncodeInterrupt(op);
                                                         if(ret == FALSE) erroneous = TRUE;
                                                     }
 
@@ -2015,147 +2088,76 @@ processor_control: INST_STC                     {
 
 
 mem: size '['  number ']'                           {
+                                                        // Direct address, always a 16-bit displacement
+                                                        const AddrMode_t *ea = ADDRESS_MODE(BASE_NONE, IDX_NONE, DISP_WORD);
                                                         $<mem_t.size>$  = $<ival>1;
                                                         $<mem_t.isSym>$ = $<imm_t.isSym>3;
-                                                        $<mem_t.mod>$   = 0b00000000;           // Memory Mode
-                                                        $<mem_t.rm>$    = 0b00000110;           // Direct Address 16-bit displacement
-                                                        $<mem_t.disp>$ = $<imm_t.val>3;
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = $<imm_t.val>3;
+                                                        PlaceReference($<imm_t.ref>3, FIELD_DISP);
                                                     }
    | size '['  base   ']'                           {
+                                                        // [BP] has no mode without displacement, it is [BP:0]
+                                                        const AddrMode_t *ea = ADDRESS_MODE($<ival>3, IDX_NONE, DISP_NONE);
                                                         $<mem_t.size>$  = $<ival>1;
                                                         $<mem_t.isSym>$ = FALSE;
-                                                        // Calculate Mod
-                                                        // There is no disp except for BP. If BP, then mod = 01 and rm = 110, disp = 0x00
-                                                        switch($<ival>3){
-                                                            case BASE_REG:
-                                                                $<mem_t.mod>$ = 0b00000000;
-                                                                $<mem_t.rm>$  = 0b00000111;
-                                                                break;
-                                                            case BASE_PTR:
-                                                                $<mem_t.mod>$ = 0b00000001;
-                                                                $<mem_t.rm>$  = 0b00000110;
-                                                                break;
-                                                        }
-                                                        $<mem_t.disp>$ = 0x0000;
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = 0x0000;
                                                     }
    | size '['  index  ']'                           {
+                                                        const AddrMode_t *ea = ADDRESS_MODE(BASE_NONE, $<ival>3, DISP_NONE);
                                                         $<mem_t.size>$  = $<ival>1;
                                                         $<mem_t.isSym>$ = FALSE;
-                                                        $<mem_t.mod>$   = 0b00000000;
-                                                        switch($<ival>3){
-                                                            case IDX_SOURCE:
-                                                                $<mem_t.rm>$ = 0b00000100;
-                                                                break;
-                                                            case IDX_DESTINATION:
-                                                                $<mem_t.rm>$ = 0b00000101;
-                                                                break;
-                                                            default:
-                                                                PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                                erroneous = TRUE;
-                                                                break;
-                                                         }
-                                                         $<mem_t.disp>$ = 0x0000;
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = 0x0000;
                                                     }
    | size '['  index  ':'  number ']'               {
-                                                        $<mem_t.size>$ = $<ival>1;
-                                                        $<mem_t.isSym>$ = $<imm_t.isSym>3;
-                                                        switch($<ival>3){
-                                                            case IDX_SOURCE:
-                                                                $<mem_t.rm>$ = 0b00000100;
-                                                                break;
-                                                            case IDX_DESTINATION:
-                                                                $<mem_t.rm>$ = 0b00000101;
-                                                                break;
-                                                        }
-                                                        short int tmp = $<imm_t.val>5;
-                                                        uint8_t sz = CalculateSize(tmp);
-                                                        if(sz == SZ_BYTE){
-                                                            $<mem_t.mod>$ = 0x01;
-                                                            $<mem_t.disp>$ = $<imm_t.val>5;
-                                                        }else if(sz == SZ_WORD){
-                                                            $<mem_t.mod>$ = 0x02;
-                                                            $<mem_t.disp>$ = $<imm_t.val>5;
-                                                        }else{
-                                                            PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                            erroneous = TRUE;
-                                                        }
+                                                        uint8_t disp = ( ($<imm_t.isSym>5 == FALSE) && (CalculateSize($<imm_t.val>5) == SZ_BYTE) ) ? DISP_BYTE : DISP_WORD;
+                                                        const AddrMode_t *ea = ADDRESS_MODE(BASE_NONE, $<ival>3, disp);
+                                                        $<mem_t.size>$  = $<ival>1;
+                                                        $<mem_t.isSym>$ = $<imm_t.isSym>5;
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = $<imm_t.val>5;
+                                                        PlaceReference($<imm_t.ref>5, FIELD_DISP);
                                                     }
    | size '['  base   ':'  number ']'               {
-                                                        $<mem_t.size>$ = $<ival>1;
-                                                        $<mem_t.isSym>$ = $<imm_t.isSym>3;
-                                                        switch($<ival>3){
-                                                            case BASE_REG:
-                                                                $<mem_t.rm>$ = 0b00000111;
-                                                                break;
-                                                            case BASE_PTR:
-                                                                $<mem_t.rm>$ = 0b00000110;
-                                                                break;
-                                                            default:
-                                                                PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                                erroneous = TRUE;
-                                                        }
-                                                        short int tmp = $<imm_t.val>5;
-                                                        uint8_t sz = CalculateSize(tmp);
-                                                        if(sz == SZ_BYTE){
-                                                            $<mem_t.mod>$ = 0x01;
-                                                            $<mem_t.disp>$ = $<imm_t.val>5;
-                                                        }else if( sz == SZ_WORD ){
-                                                            $<mem_t.mod>$ = 0x02;
-                                                            $<mem_t.disp>$ = $<imm_t.val>5;
-                                                        }else{
-                                                            PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                            erroneous = TRUE;
-                                                        }
+                                                        uint8_t disp = ( ($<imm_t.isSym>5 == FALSE) && (CalculateSize($<imm_t.val>5) == SZ_BYTE) ) ? DISP_BYTE : DISP_WORD;
+                                                        const AddrMode_t *ea = ADDRESS_MODE($<ival>3, IDX_NONE, disp);
+                                                        $<mem_t.size>$  = $<ival>1;
+                                                        $<mem_t.isSym>$ = $<imm_t.isSym>5;
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = $<imm_t.val>5;
+                                                        PlaceReference($<imm_t.ref>5, FIELD_DISP);
                                                     }
    | size '['  base   ':'  index  ']'               {
-                                                        $<mem_t.size>$ = $<ival>1;
+                                                        const AddrMode_t *ea = ADDRESS_MODE($<ival>3, $<ival>5, DISP_NONE);
+                                                        $<mem_t.size>$  = $<ival>1;
                                                         $<mem_t.isSym>$ = FALSE;
-                                                        if( ($<ival>3 == BASE_REG) && ($<ival>5 == IDX_SOURCE) ){
-                                                            $<mem_t.mod>$ = 0x00;
-                                                            $<mem_t.rm>$  = 0x00;
-                                                            $<mem_t.disp>$ = 0x00;
-                                                        }else if( ($<ival>3 == BASE_REG) && ($<ival>5 == IDX_DESTINATION) ){
-                                                            $<mem_t.mod>$ = 0x00;
-                                                            $<mem_t.rm>$  = 0x01;
-                                                            $<mem_t.disp>$ = 0x00;
-                                                        }else if( ($<ival>3 == BASE_PTR) && ($<ival>5 == IDX_SOURCE) ){
-                                                            $<mem_t.mod>$ = 0x00;
-                                                            $<mem_t.rm>$  = 0x02;
-                                                            $<mem_t.disp>$ = 0x00;
-                                                        }else if( ($<ival>3 == BASE_PTR) && ($<ival>5 == IDX_DESTINATION) ){
-                                                            $<mem_t.mod>$ = 0x00;
-                                                            $<mem_t.rm>$  = 0x03;
-                                                            $<mem_t.disp>$ = 0x00;
-                                                        }else{
-                                                            PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                            erroneous = TRUE;
-                                                        }
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = 0x0000;
                                                     }
    | size '['  base   ':'  index ':' number ']'     {
-                                                        $<mem_t.size>$ = $<ival>1;
+                                                        uint8_t disp = ( ($<imm_t.isSym>7 == FALSE) && (CalculateSize($<imm_t.val>7) == SZ_BYTE) ) ? DISP_BYTE : DISP_WORD;
+                                                        const AddrMode_t *ea = ADDRESS_MODE($<ival>3, $<ival>5, disp);
+                                                        $<mem_t.size>$  = $<ival>1;
                                                         $<mem_t.isSym>$ = $<imm_t.isSym>7;
-                                                        short int tmp = $<imm_t.val>7;
-                                                        uint8_t sz = CalculateSize(tmp);
-                                                        if( ($<ival>3 == BASE_REG) && ($<ival>5 == IDX_SOURCE) ){
-                                                            $<mem_t.mod>$ = (sz == SZ_WORD) ? 0x02 : 0x01;
-                                                            $<mem_t.rm>$  = 0x00;
-                                                            $<mem_t.disp>$ = $<imm_t.val>7;
-                                                        }else if( ($<ival>3 == BASE_REG) && ($<ival>5 == IDX_DESTINATION) ){
-                                                            $<mem_t.mod>$ = (sz == SZ_WORD) ? 0x02 : 0x01;
-                                                            $<mem_t.rm>$  = 0x01;
-                                                            $<mem_t.disp>$ = $<imm_t.val>7;
-                                                        }else if( ($<ival>3 == BASE_PTR) && ($<ival>5 == IDX_SOURCE) ){
-                                                            $<mem_t.mod>$ = (sz == SZ_WORD) ? 0x02 : 0x01;
-                                                            $<mem_t.rm>$  = 0x02;
-                                                            $<mem_t.disp>$ = $<imm_t.val>7;
-                                                        }else if( ($<ival>3 == BASE_PTR) && ($<ival>5 == IDX_DESTINATION) ){
-                                                            $<mem_t.mod>$ = (sz == SZ_WORD) ? 0x02 : 0x01;
-                                                            $<mem_t.rm>$  = 0x03;
-                                                            $<mem_t.disp>$ = $<imm_t.val>7;
-                                                        }else{
-                                                            PrintError(COLOR_BOLDRED, "Line %d, Internal Error!\n", LN);
-                                                            erroneous = TRUE;
-                                                        }
+                                                        $<mem_t.mod>$   = ea->mod;
+                                                        $<mem_t.rm>$    = ea->rm;
+                                                        $<mem_t.disps>$ = ea->disps;
+                                                        $<mem_t.disp>$  = $<imm_t.val>7;
+                                                        PlaceReference($<imm_t.ref>7, FIELD_DISP);
                                                     }
 ;
 size: %empty        { $<ival>$ = SZ_WORD;  }
@@ -2239,32 +2241,56 @@ sreg: SREG_CS   { $<ival>$ = SREG_CODE;    }
     | SREG_ES   { $<ival>$ = SREG_EXTRA;   }
     | SREG_SS   { $<ival>$ = SREG_SEGMENT; }
 ;
-number: NUMBER                  { $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$ = FALSE; }
+number: NUMBER                  {
+                                    if( ($<imm_t.wide>1 > 32767) || ($<imm_t.wide>1 < -32768) ){
+                                        PrintError(COLOR_BOLDRED, "Line %d :: Number size overflow!\n", LN);
+                                        erroneous = TRUE;
+                                    }
+                                    $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$ = FALSE; $<imm_t.ref>$ = -1;
+                                }
       | SEGNAME                 { 
                                     size_t tmp = CheckSegmentExistence($<sval>1);
                                     if(tmp < 0){
                                         PrintError(COLOR_BOLDRED, "Line %d :: Segment Registration Error!\n", LC);
                                         ExitSafely(EXIT_FAILURE);
                                     }
-                                    $<imm_t.val>$   = SegmentTable[tmp].loc;
+                                    if(Options.format == FORMAT_MZ)
+                                        $<imm_t.val>$ = GetSegmentParagraph(tmp);     // Relocated by the loader
+                                    else if(Options.format == FORMAT_OBJ)
+                                        $<imm_t.val>$ = 0;                            // Relocated by the linker
+                                    else
+                                        $<imm_t.val>$ = SegmentTable[tmp].loc;
                                     $<imm_t.isSym>$ = TRUE;
+                                    $<imm_t.ref>$   = AddReference(REF_SEGMENT, tmp, $<imm_t.val>$);
                                 }
       | LABEL                   {
                                     size_t tmp = CheckLabelExistence($<sval>1);
-                                    if(tmp < 0){
-                                        PrintError(COLOR_BOLDRED, "Line %d :: Label Registration Error!\n", LC);
+                                    $<imm_t.isSym>$ = TRUE;
+                                    if(tmp != (size_t) -1){
+                                        $<imm_t.val>$ = LabelTable[tmp].loc;
+                                        $<imm_t.ref>$ = AddReference(REF_OFFSET, CheckSegmentExistence(LabelTable[tmp].segname), $<imm_t.val>$);
+                                    }else if(Options.format == FORMAT_OBJ){
+                                        tmp = AddExternSymbol($<sval>1);                // Resolved by the linker
+                                        if(tmp == (size_t) -1)
+                                            ExitSafely(EXIT_FAILURE);
+                                        $<imm_t.val>$ = 0;
+                                        $<imm_t.ref>$ = AddReference(REF_EXTERN, tmp, 0);
+                                    }else{
+                                        PrintError(COLOR_BOLDRED, "Line %d :: Label %s is not defined!\n", LN, $<sval>1);
                                         ExitSafely(EXIT_FAILURE);
                                     }
-                                    $<imm_t.val>$   = LabelTable[tmp].loc;
-                                    $<imm_t.isSym>$ = TRUE;
                                 }
-      | DIR_HERE                { $<imm_t.val>$ = SegmentTable[stsize-1].LC; $<imm_t.isSym>$ = FALSE; }
+      | DIR_HERE                {
+                                    $<imm_t.val>$ = SegmentTable[CurrentSegment].LC; $<imm_t.isSym>$ = FALSE;
+                                    $<imm_t.ref>$ = AddReference(REF_OFFSET, CurrentSegment, $<imm_t.val>$);
+                                }
       | number '+' number       {
                                     $<imm_t.val>$ = (short int) ( $<imm_t.val>1 + $<imm_t.val>3 );
                                     if(( ($<imm_t.isSym>1 == TRUE) || ($<imm_t.isSym>3 == TRUE) ))
                                         $<imm_t.isSym>$ = TRUE;
                                     else
                                         $<imm_t.isSym>$ = FALSE;
+                                    $<imm_t.ref>$ = CombineReferences($<imm_t.ref>1, $<imm_t.ref>3, '+', $<imm_t.val>$);
                                 }
       | number '-' number       {
                                     $<imm_t.val>$ = (short int) ( $<imm_t.val>1 - $<imm_t.val>3 );
@@ -2272,6 +2298,7 @@ number: NUMBER                  { $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$
                                         $<imm_t.isSym>$ = TRUE;
                                     else
                                         $<imm_t.isSym>$ = FALSE;
+                                    $<imm_t.ref>$ = CombineReferences($<imm_t.ref>1, $<imm_t.ref>3, '-', $<imm_t.val>$);
                                 }
       | number '*' number       {
                                     $<imm_t.val>$ = (short int) ( $<imm_t.val>1 * $<imm_t.val>3 );
@@ -2279,6 +2306,7 @@ number: NUMBER                  { $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$
                                         $<imm_t.isSym>$ = TRUE;
                                     else
                                         $<imm_t.isSym>$ = FALSE;
+                                    $<imm_t.ref>$ = CombineReferences($<imm_t.ref>1, $<imm_t.ref>3, '*', $<imm_t.val>$);
                                 }
       | number '/' number       {
                                     if( $<imm_t.val>3 != 0 ){
@@ -2288,9 +2316,10 @@ number: NUMBER                  { $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$
                                     else
                                         $<imm_t.isSym>$ = FALSE;
                                     }else{
-                                        PrintError(COLOR_BOLDYELLOW, "Line %d :: Division by 0\n", LN);
+                                        PrintError(COLOR_RED, "Line %d :: Division by 0\n", LN);
                                         erroneous = TRUE;
                                     }
+                                    $<imm_t.ref>$ = CombineReferences($<imm_t.ref>1, $<imm_t.ref>3, '/', $<imm_t.val>$);
                                 }
       | number '<' number       {
                                     $<imm_t.val>$ = (short int) ( $<imm_t.val>1 << $<imm_t.val>3 );
@@ -2298,6 +2327,7 @@ number: NUMBER                  { $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$
                                         $<imm_t.isSym>$ = TRUE;
                                     else
                                         $<imm_t.isSym>$ = FALSE;
+                                    $<imm_t.ref>$ = CombineReferences($<imm_t.ref>1, $<imm_t.ref>3, '<', $<imm_t.val>$);
                                 }
       | number '>' number       {
                                     $<imm_t.val>$ = (short int) ( $<imm_t.val>1 >> $<imm_t.val>3 );
@@ -2305,6 +2335,7 @@ number: NUMBER                  { $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$
                                         $<imm_t.isSym>$ = TRUE;
                                     else
                                         $<imm_t.isSym>$ = FALSE;
+                                    $<imm_t.ref>$ = CombineReferences($<imm_t.ref>1, $<imm_t.ref>3, '>', $<imm_t.val>$);
                                 }
       | number '^' number       {
                                     $<imm_t.val>$ = (short int) pow((double)$<imm_t.val>1, (double)$<imm_t.val>3);
@@ -2312,17 +2343,36 @@ number: NUMBER                  { $<imm_t.val>$ = $<imm_t.val>1; $<imm_t.isSym>$
                                         $<imm_t.isSym>$ = TRUE;
                                     else
                                         $<imm_t.isSym>$ = FALSE;
+                                    $<imm_t.ref>$ = CombineReferences($<imm_t.ref>1, $<imm_t.ref>3, '^', $<imm_t.val>$);
                                 }
       | number '!'              {
                                     $<imm_t.isSym>$ = $<imm_t.isSym>1;
                                     $<imm_t.val>$ = ComputeFactorial($<imm_t.val>1);
+                                    $<imm_t.ref>$ = CombineReferences($<imm_t.ref>1, -1, '!', $<imm_t.val>$);
                                 }
 ;
 
 
+
+/* Repeat counts are not limited to 16 bits */
+count: NUMBER                   { $<lval>$ = $<imm_t.wide>1; }
+     | DIR_HERE                 { $<lval>$ = SegmentTable[CurrentSegment].LC; }
+     | count '+' count          { $<lval>$ = $<lval>1 + $<lval>3; }
+     | count '-' count          { $<lval>$ = $<lval>1 - $<lval>3; }
+     | count '*' count          { $<lval>$ = $<lval>1 * $<lval>3; }
+     | count '/' count          {
+                                    if( $<lval>3 != 0 ){
+                                        $<lval>$ = $<lval>1 / $<lval>3;
+                                    }else{
+                                        PrintError(COLOR_RED, "Line %d :: Division by 0\n", LN);
+                                        erroneous = TRUE;
+                                        $<lval>$ = 0;
+                                    }
+                                }
+;
 %%
 
 void yyerror(const char *s)
 {
-    PrintError(COLOR_BOLDYELLOW, "Line %d, %s\n", LN, s);
+    PrintError(COLOR_RED, "Line %d, %s\n", LN, s);
 }
\ No newline at end of file
@@ -9,24 +9,28 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <fcntl.h>
 #include <sys/types.h>
 #include <sys/ipc.h>
 #include <sys/shm.h>
 #include "../../include/Definitions.h"
 #include "../../include/Errors.h"
 #include "../../include/Assembler.h"
+#include "../../include/Options.h"
+#include "../../include/Tokens.h"
 #include "Pass2Scanner.h"
 
 /* Global Variables */
 Boolean_t erroneous;                // Is there any error?
 Fname_t SrcFile;                    // Source File to be scanned/parsed
 LCounter_t LN;                      // Line Number
-MCounter_t LC;                      // Global Location Counter
+LCounter_t LC;                      // Global Location Counter
 Flag_t isORG;                       // Is ORG directive used
 Flag_t isSOP;                       // Is segment is overwridden
 uint8_t SOP;                        // Overridden Segment
-FILE *fdest;
 char *dstfile;
+SourceBuffer_t Source;              // Mapped preprocessed file
+FILE *fsrc;                         // Preprocessed file in streaming mode
 
 /* Tables */
 Segment_t *SegmentTable;            // Segments
@@ -41,13 +45,44 @@ extern uint8_t errcode;                                     // Error Code for In
 extern void PrintError(char *color, char *format, ...);     // Print Custom Error Message
 extern void InternalError(char *format, ...);               // Print Internal Error Message
 extern void ExternalError(char *format, ...);               // Print External Error Message
+extern void NameDiagnosticsFile(const char *path);          // Source the diagnostics belong to
 
 /* Flex/Bison Functions/Variables */
 extern int yylex();                             // Flex Scanner Function
 extern int yyparse();                           // Bison Parser Function
 extern FILE *yyin;                              // Flex/Bison Input Buffer
 
-void WriteByte2File(uint8_t byte);              // Write byte values to the destination file (srcfilename.bin)
+/* Options */
+extern Options_t Options;
+extern void DecodeOptions(int argc, char **argv);
+
+/* Source Mapping */
+extern Boolean_t MapSourceFile(const char *path, SourceBuffer_t *src);
+extern void UnmapSourceFile(SourceBuffer_t *src);
+
+/* Output */
+extern Boolean_t OpenOutput(const char *path);  // Create the destination file (srcfilename.bin/hex/srec)
+extern void CloseOutput(void);                  // Finish and close the destination file
+extern LCounter_t SegmentRefs;                  // Segment references counted by pass 1
+
+/* Listing */
+extern Boolean_t OpenListing(const char *src);  // Listing sink of -l
+extern Boolean_t OpenSymbolMap(const char *path);   // Map sink of -m
+
+/* Tokenized Sources */
+extern Flag_t TokenInput;
+extern Boolean_t IsTokenFile(const char *path);
+extern Boolean_t OpenTokenFile(const char *path);
+extern void CloseTokenFile(void);
+extern Boolean_t AttachTokenRecord(const char *path, size_t size);
+
+/* Instruction IR */
+extern Boolean_t AttachIR(const char *path, size_t size);
+extern void DetachIR(void);
+
+/* Encoding Cache */
+extern void PrintEncodeStats(FILE *file);       // Counters of --stats
+
 int GetSymbolTable(long long int symtabsize);   // Create Segment and Label Tables via Symbol Table
 void ExitSafely(int retcode);                   // Release resouces and Exit
 void InitializePass2(void);                     // Initialize Global Variables
@@ -62,31 +97,84 @@ int main(int argc, char **argv)
     --argc;
     ++argv;
     InitializePass2();                  // Initialize Variables
+    DecodeOptions(argc-6, argv+6);      // Options follow the positional arguments
+    NameDiagnosticsFile(argv[5]);       // Source given to qasm, the preprocessed one is hidden
     strcpy(SrcFile, argv[1]);           // Register Source File
     GetSymbolTable(atoll(argv[0]));     // Get Symbol Table SHM
+    SegmentRefs = atol(argv[2]);        // Reserves the relocation table of an executable
+    size_t toksize = atol(argv[3]);     // Tokens recorded by pass 1, 0 to scan the source
+    size_t irsize = atol(argv[4]);      // Instructions pass 1 recorded of these tokens
 
     size_t len = strlen(argv[1]);
-    dstfile = malloc((len-1)*sizeof(char));
-    size_t idx;
-    for(idx=1; idx<len-3; idx++){
-        dstfile[idx-1] = argv[1][idx];
+    dstfile = calloc(len+2, sizeof(char));   // Room for the longest extension
+    if(IsTokenFile(argv[1]) == TRUE){
+        // name.qsmb is not a hidden file, only its extension is replaced
+        memcpy(dstfile, argv[1], len-strlen(TOKFILE_EXT)+1);
+    }else{
+        size_t idx;
+        for(idx=1; idx<len-3; idx++){
+            dstfile[idx-1] = argv[1][idx];
+        }
     }
-    strcat(dstfile, "bin");
+    if(Options.format == FORMAT_IHEX)
+        strcat(dstfile, "hex");
+    else if(Options.format == FORMAT_SREC)
+        strcat(dstfile, "srec");
+    else if(Options.format == FORMAT_MZ)
+        strcat(dstfile, "exe");
+    else if(Options.format == FORMAT_OBJ)
+        strcat(dstfile, "obj");
+    else
+        strcat(dstfile, "bin");
     
-    FILE *fd = fopen(argv[1], "r");
-    if(!fd){
-        ExternalError("Failed to open source file!\n");
+    if(IsTokenFile(argv[1]) == TRUE){
+        if(OpenTokenFile(argv[1]) == FALSE){
+            ExternalError("Failed to open source file: ");
+            ExitSafely(EXIT_FAILURE);
+        }
+    }else if(toksize > 0){
+        if(AttachTokenRecord(SrcFile, toksize) == FALSE){
+            ExternalError("Failed to receive the tokens of pass 1: ");
+            ExitSafely(EXIT_FAILURE);
+        }
+        if( (irsize > 0) && (AttachIR(SrcFile, irsize) == FALSE) ){
+            ExternalError("Failed to receive the instructions of pass 1: ");
+            ExitSafely(EXIT_FAILURE);
+        }
+    }else if(Options.stream == SET){
+        fsrc = fopen(argv[1], "r");
+        if(!fsrc){
+            ExternalError("Failed to open source file: ");
+            ExitSafely(EXIT_FAILURE);
+        }
+        setvbuf(fsrc, NULL, _IOFBF, STREAM_BUFSIZE);
+        posix_fadvise(fileno(fsrc), 0, 0, POSIX_FADV_SEQUENTIAL);
+    }else if(MapSourceFile(argv[1], &Source) == FALSE){
+        // Pages of the preprocessed file are usually still cached from pass 1
+        ExternalError("Failed to open source file: ");
         ExitSafely(EXIT_FAILURE);
     }
-    fdest = fopen(dstfile, "wb");
-    if(!fdest){
+    if(OpenOutput(dstfile) == FALSE){
         ExternalError("Failed to open destination file: ");
         ExitSafely(EXIT_FAILURE);
     }
+    if( Options.listing && (OpenListing(argv[1]) == FALSE) ){
+        ExternalError("Failed to open listing file: ");
+        ExitSafely(EXIT_FAILURE);
+    }
+    if( Options.mapfile && (OpenSymbolMap(Options.mapfile) == FALSE) ){
+        ExternalError("Failed to open symbol map: ");
+        ExitSafely(EXIT_FAILURE);
+    }
 
-    yyin = fd;
+    if(fsrc)
+        yyin = fsrc;
+    else if(TokenInput == NSET)         // Tokens are replayed by yylex()
+        yy_scan_buffer(Source.base, Source.len+2);
     yyparse();
 
+    if(Options.stats == SET)
+        PrintEncodeStats(stderr);
 
     ExitSafely(EXIT_SUCCESS);
 }
@@ -106,6 +194,7 @@ void InitializePass2(void)
     stsize = 0;
     ltsize = 0;
     CurrentSegment = 0;
+    fsrc = NULL;
 
     erroneous = FALSE;
     isSOP     = NSET;
@@ -150,12 +239,14 @@ int GetSymbolTable(long long int symtabsize)
                 strncpy(SegmentTable[stsize].name, SymbolTable[idx].sname, SEGNAMEMAX);
                 SegmentTable[stsize].LC = 0; //SymbolTable[idx].LC;
                 SegmentTable[stsize].loc = SymbolTable[idx].loc;
+                SegmentTable[stsize].size = SymbolTable[idx].LC;
                 stsize++; 
             }else{
                 SegmentTable = realloc(SegmentTable, (stsize+1)*sizeof(Segment_t));
                 strncpy(SegmentTable[stsize].name, SymbolTable[idx].sname, SEGNAMEMAX);
                 SegmentTable[stsize].LC = 0; //SymbolTable[idx].LC;
                 SegmentTable[stsize].loc = SymbolTable[idx].loc;
+                SegmentTable[stsize].size = SymbolTable[idx].LC;
                 stsize++;
             }
         }else if(SymbolTable[idx].type == TYPE_LABEL){
@@ -185,41 +276,42 @@ int GetSymbolTable(long long int symtabsize)
         ExternalError("Failed to detach SHM: ");
         ExitSafely(EXIT_FAILURE);
     }
+    SymbolTable = NULL;
 
     return RET_SUCCESS;
 }
 
 //-----------------------------------------------------------------------------
 
-void WriteByte2File(uint8_t byte)
-{
-    uint8_t *buf = malloc(sizeof(uint8_t));
-    buf[0] = byte;
-    fwrite(buf, sizeof(uint8_t), 1, fdest);
-
-    return;
-}
-
-//-----------------------------------------------------------------------------
-
 void ExitSafely(int retcode)
 {
-    fclose(fdest);
+    UnmapSourceFile(&Source);
+    if(fsrc)
+        fclose(fsrc);
+    CloseTokenFile();
+    DetachIR();
+    CloseOutput();                      // The listing reads the preprocessed file, remove it only now
     char *cmd;
-    cmd = malloc( (strlen(SrcFile)+ strlen("rm -f "))*sizeof(char) );
+    cmd = malloc( (strlen(SrcFile)+strlen(dstfile ? dstfile : "")+strlen("rm -f ")+1)*sizeof(char) );
     strcpy(cmd, "rm -f ");
     strcat(cmd, SrcFile);
-    system(cmd);
+    if(IsTokenFile(SrcFile) == FALSE)   // A tokenized source is kept like the source it replaces
+        system(cmd);
 
-    free(SymbolTable);
     free(SegmentTable);
     free(LabelTable);
-    free(fdest);
 
-    if(retcode == EXIT_FAILURE){
+    if( (retcode == EXIT_FAILURE) && dstfile ){
         strcpy(cmd, "rm -f ");
         strcat(cmd, dstfile);
         system(cmd);
+        if(Options.listing)
+            remove(Options.listing);
+        if(Options.mapfile)
+            remove(Options.mapfile);
+        SCounter_t emit;
+        for(emit=0; emit<Options.emits; emit++)
+            remove(Options.emit[emit].path);
     }
     free(dstfile);
 
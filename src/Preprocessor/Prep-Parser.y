@@ -12,7 +12,16 @@
 #include "../../include/Errors.h"
 
 Variable_t *VariableTable;
-MCounter_t VarTabIdx;
+LCounter_t VarTabIdx;           // Number of registered variables
+LCounter_t VarTabCap;           // Allocated entries of VariableTable
+LCounter_t *VarHashTable;       // Open addressed slots, holds (index+1) of VariableTable, 0 is empty
+LCounter_t VarHashCap;          // Number of slots, always a power of two
+
+char **StrPoolTable;            // Open addressed slots of interned strings
+LCounter_t StrPoolCnt;          // Number of interned strings
+LCounter_t StrPoolCap;          // Number of slots, always a power of two
+char *StrArena;                 // Current chunk of interned string storage
+size_t StrArenaLeft;            // Free bytes left inside the current chunk
 extern LCounter_t LN;
 extern Fname_t dest;
 
@@ -21,8 +30,10 @@ extern void PrintError(char *color, char *format, ...);
 extern void InternalError(char *format, ...);
 extern void ExternalError(char *format, ...);
 
-int CheckVariableExistence(char *name);
+long int CheckVariableExistence(char *name);
 int RegisterVariable(char *name, char *value);
+LCounter_t HashString(const char *str);
+char *InternString(char *str);
 
 extern void WriteToFile(char *str);
 extern int yylex();
@@ -44,7 +55,7 @@ extern FILE *fdest;
 %%
 
 exp: %empty
-    | exp VALUE             { WriteToFile($<sval>2); }
+    | exp VALUE             { WriteToFile($<sval>2); free($<sval>2); }
     | exp NL                { /* Do nothing */ }
     | exp VARNAME VALUE NL  { 
         RegisterVariable($<sval>2, $<sval>3);
@@ -53,7 +64,8 @@ exp: %empty
         yyerror("Syntax Error: No value for variable");
     }
     | exp INSTANCE      {
-        int existence = CheckVariableExistence($<sval>2);
+        long int existence = CheckVariableExistence($<sval>2);
+        free($<sval>2);
         if(existence == -1){
             yyerror("Variable is not defined");
             exit(EXIT_FAILURE);
@@ -66,45 +78,152 @@ exp: %empty
 %%
 
 void yyerror(const char *s){
-    PrintError(COLOR_RED, "%s in line %d\n", s, LN);
+    PrintError(COLOR_RED, "Line %d, %s\n", LN, s);
     fclose(fdest);
     remove(dest);
     exit(EXIT_FAILURE);
 }
 
-int RegisterVariable(char *name, char *value)
+#define VARTAB_INITCAP   64          // Initial number of variables, grows by doubling
+#define STRPOOL_INITCAP  256         // Initial number of interned string slots
+#define STRARENA_CHUNK   65536       // Size of a string storage chunk
+
+/* FNV-1a, good enough for identifiers and short constant values */
+LCounter_t HashString(const char *str)
+{
+    LCounter_t hash = 2166136261u;
+    while(*str){
+        hash ^= (uint8_t) *str++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/* Returns the single shared copy of str. The argument is not retained */
+char *InternString(char *str)
 {
+    LCounter_t hash = HashString(str);
+    LCounter_t slot;
+
+    if(StrPoolCnt+1 > (StrPoolCap - (StrPoolCap >> 2))){    // Keep the load factor below 3/4
+        LCounter_t newcap = (StrPoolCap == 0) ? STRPOOL_INITCAP : StrPoolCap << 1;
+        if(newcap == 0){
+            yyerror("Error: Too many distinct variable names and values!");
+        }
+        char **newtab = calloc(newcap, sizeof(char*));
+        if(!newtab){
+            ExternalError("Failed to allocate string pool: ");
+            yyerror("Error: Out of memory");
+        }
+        LCounter_t idx;
+        for(idx=0; idx<StrPoolCap; idx++){
+            if(StrPoolTable[idx] == NULL)
+                continue;
+            slot = HashString(StrPoolTable[idx]) & (newcap-1);
+            while(newtab[slot] != NULL)
+                slot = (slot+1) & (newcap-1);
+            newtab[slot] = StrPoolTable[idx];
+        }
+        free(StrPoolTable);
+        StrPoolTable = newtab;
+        StrPoolCap = newcap;
+    }
+
+    slot = hash & (StrPoolCap-1);
+    while(StrPoolTable[slot] != NULL){
+        if(strcmp(StrPoolTable[slot], str) == 0)
+            return StrPoolTable[slot];
+        slot = (slot+1) & (StrPoolCap-1);
+    }
 
-    int existence = CheckVariableExistence(name);
+    // Copy the string into the arena, large strings get their own chunk
+    size_t len = strlen(str) + 1;
+    char *copy;
+    if(len > STRARENA_CHUNK/4){
+        copy = malloc(len);
+    }else{
+        if(len > StrArenaLeft){
+            StrArena = malloc(STRARENA_CHUNK);
+            StrArenaLeft = (StrArena) ? STRARENA_CHUNK : 0;
+        }
+        copy = StrArena;
+        StrArena += len;
+        StrArenaLeft -= len;
+    }
+    if(!copy){
+        ExternalError("Failed to allocate string pool: ");
+        yyerror("Error: Out of memory");
+    }
+    memcpy(copy, str, len);
+
+    StrPoolTable[slot] = copy;
+    StrPoolCnt++;
+    return copy;
+}
+
+int RegisterVariable(char *name, char *value)
+{
+    long int existence = CheckVariableExistence(name);
     if(existence != -1){
         yyerror("Error: Multiple variable definition in source file!");
     }
-    if(VariableTable == NULL){
-        VarTabIdx = 0;
-        VariableTable = (Variable_t*)malloc(sizeof(Variable_t));
-        VariableTable[VarTabIdx].name = name;
-        VariableTable[VarTabIdx].value = value;
-        VarTabIdx++;
-    }else{
-        VariableTable = (Variable_t*) realloc(VariableTable, (VarTabIdx+1)*sizeof(Variable_t));
-        VariableTable[VarTabIdx].name = name;
-        VariableTable[VarTabIdx].value = value;
-        VarTabIdx++;
+
+    if(VarTabIdx == VarTabCap){
+        LCounter_t newcap = (VarTabCap == 0) ? VARTAB_INITCAP : VarTabCap << 1;
+        if(newcap == 0){
+            yyerror("Error: Too many variables in source file!");
+        }
+        Variable_t *newtab = realloc(VariableTable, (size_t)newcap*sizeof(Variable_t));
+        LCounter_t *newhash = calloc((size_t)newcap << 1, sizeof(LCounter_t));
+        if(!newtab || !newhash){
+            ExternalError("Failed to allocate variable table: ");
+            yyerror("Error: Out of memory");
+        }
+        VariableTable = newtab;
+        VarTabCap = newcap;
+
+        // Slots are twice the entries, so the load factor stays at or below 1/2
+        free(VarHashTable);
+        VarHashTable = newhash;
+        VarHashCap = newcap << 1;
+        LCounter_t idx, slot;
+        for(idx=0; idx<VarTabIdx; idx++){
+            slot = VariableTable[idx].hash & (VarHashCap-1);
+            while(VarHashTable[slot] != 0)
+                slot = (slot+1) & (VarHashCap-1);
+            VarHashTable[slot] = idx+1;
+        }
     }
 
+    LCounter_t hash = HashString(name);
+    LCounter_t slot = hash & (VarHashCap-1);
+    while(VarHashTable[slot] != 0)
+        slot = (slot+1) & (VarHashCap-1);
+
+    VariableTable[VarTabIdx].name  = InternString(name);
+    VariableTable[VarTabIdx].value = InternString(value);
+    VariableTable[VarTabIdx].hash  = hash;
+    VarHashTable[slot] = VarTabIdx+1;
+    VarTabIdx++;
+
+    free(name);     // Scanner copies are not needed after interning
+    free(value);
     return 0;
 }
 
-int CheckVariableExistence(char *name)
+long int CheckVariableExistence(char *name)
 {
-    if(VarTabIdx > 0){
-        int idx;
-        for(idx = 0; idx < VarTabIdx; idx++){
-            if( strcmp(VariableTable[idx].name, name) == 0 ){
-                return idx;
-            }
-        }
+    if(VarTabIdx == 0)
+        return -1;
+
+    LCounter_t hash = HashString(name);
+    LCounter_t slot = hash & (VarHashCap-1);
+    while(VarHashTable[slot] != 0){
+        Variable_t *var = &VariableTable[VarHashTable[slot]-1];
+        if( (var->hash == hash) && (strcmp(var->name, name) == 0) )
+            return VarHashTable[slot]-1;
+        slot = (slot+1) & (VarHashCap-1);
     }
 
     return -1;
-}
\ No newline at end of file
+}
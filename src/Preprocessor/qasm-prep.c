@@ -11,10 +11,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <fcntl.h>
 #include "../../include/Definitions.h"
 #include "../../include/Errors.h"
+#include "../../include/Options.h"
 #include "PrepScan.h"
 
+#define PREP_OUTBUFSIZE 65536     // stdio buffer of the preprocessed file
+
 LCounter_t LN;
 FILE *fdest;
 Fname_t dest;
@@ -23,32 +27,79 @@ extern uint8_t errcode;
 extern void PrintError(char *color, char *format, ...);
 extern void InternalError(char *format, ...);
 extern void ExternalError(char *format, ...);
+extern void NameDiagnosticsFile(const char *path);
 extern int yylex();
 extern int yyparse();
+extern void yyerror(const char *s);
 extern FILE *yyin;
 
+/* Variable Table */
+extern Variable_t *VariableTable;
+extern long int CheckVariableExistence(char *name);
+
+/* Options */
+extern Options_t Options;
+extern void DecodeOptions(int argc, char **argv);
+
+/* Source Mapping */
+extern Boolean_t MapSourceFile(const char *path, SourceBuffer_t *src);
+extern void UnmapSourceFile(SourceBuffer_t *src);
+
+/* Fast Scanning */
+extern const char *ScanForSet(const char *p, const char *end, const ScanSet_t *set, LCounter_t *newlines);
+extern void InitScanSet(ScanSet_t *set, const char *chars);
+
 void WriteToFile(char *str);
+void WriteSpanToFile(const char *str, size_t len);
+void PreprocessBuffer(char *buf, size_t len);
+const char *FindSegmentOpen(const char *p, const char *end);
+const char *ScanSegmentBody(const char *p, const char *end);
+void ParseTopLevel(char *p, size_t len);
+
+ScanSet_t TopLevelSet;      // { opens a segment, ; and " hide it
+ScanSet_t SegmentSet;       // Only these bytes need work inside a segment
 
 int main(int argc, char **argv)
 {
     //printf("Prep: Source File: %s\n", argv[1]);
     //printf("Prep: Dest File: %s\n", argv[2]);
     strcpy(dest, argv[2]);
-    FILE *fsrc = fopen(argv[1], "r");
-    if(!fsrc){
+    DecodeOptions(argc-3, argv+3);
+    NameDiagnosticsFile(argv[1]);
+
+    SourceBuffer_t src;
+    FILE *fsrc = NULL;
+    Boolean_t ret;
+    if(Options.stream == SET){
+        fsrc = fopen(argv[1], "r");
+        ret = (fsrc != NULL);
+    }else
+        ret = MapSourceFile(argv[1], &src);
+    if(ret == FALSE){
         ExternalError("Failed to read preprocessor source file: ");
         remove(dest);
         exit(EXIT_FAILURE);
     }
-    yyin = fsrc;
     fdest = fopen(argv[2], "w");
     if(!fdest){
         ExternalError("Failed to open preprocessor destination file: ");
         remove(dest);
         exit(EXIT_FAILURE);
     }
+    setvbuf(fdest, NULL, _IOFBF, PREP_OUTBUFSIZE);
     LN = 1;
-    yyparse();
+
+    if(Options.stream == SET){
+        // Flex alone reads the source through a fixed buffer
+        setvbuf(fsrc, NULL, _IOFBF, STREAM_BUFSIZE);
+        posix_fadvise(fileno(fsrc), 0, 0, POSIX_FADV_SEQUENTIAL);
+        yyin = fsrc;
+        yyparse();
+        fclose(fsrc);
+    }else{
+        PreprocessBuffer(src.base, src.len);
+        UnmapSourceFile(&src);
+    }
 
     fclose(fdest);
     return EXIT_SUCCESS;
@@ -57,5 +108,126 @@ int main(int argc, char **argv)
 
 void WriteToFile(char *str)
 {
-    fprintf(fdest, "%s", str);
-}
\ No newline at end of file
+    WriteSpanToFile(str, strlen(str));
+}
+
+void WriteSpanToFile(const char *str, size_t len)
+{
+    fwrite(str, sizeof(char), len, fdest);
+}
+
+//---------------------------------------------------------------------------
+
+/* Segment bodies are copied by the vectorized scanner, flex and bison only
+   see the text between segments where the variables are defined */
+void PreprocessBuffer(char *buf, size_t len)
+{
+    char *p = buf;
+    const char *end = buf + len;
+
+    InitScanSet(&TopLevelSet, "{;\"");
+    InitScanSet(&SegmentSet, "@;}");
+
+    while(p < end){
+        char *brace = (char *) FindSegmentOpen(p, end);
+        if(brace > p)
+            ParseTopLevel(p, brace - p);
+        if(brace == end)
+            break;
+
+        WriteSpanToFile(brace, 1);
+        p = (char *) ScanSegmentBody(brace+1, end);
+    }
+}
+
+/* The region is scanned in place, the two bytes after it are replaced by
+   the NULs yy_scan_buffer() needs and put back afterwards. The source is
+   mapped privately and always followed by two NULs, so this is safe */
+void ParseTopLevel(char *p, size_t len)
+{
+    char saved[2] = { p[len], p[len+1] };
+    p[len] = p[len+1] = '\0';
+
+    YY_BUFFER_STATE state = yy_scan_buffer(p, len+2);
+    yyparse();
+    yy_delete_buffer(state);
+
+    p[len] = saved[0];
+    p[len+1] = saved[1];
+}
+
+/* Finds the next '{' which is neither commented out nor quoted. Quotes
+   follow the VALUE rule of Prep-Scanner.l, an unterminated one is text */
+const char *FindSegmentOpen(const char *p, const char *end)
+{
+    LCounter_t skipped = 0;     // Newlines are counted by the scanner
+
+    while(p < end){
+        p = ScanForSet(p, end, &TopLevelSet, &skipped);
+        if(p == end || *p == '{')
+            return p;
+
+        if(*p == ';'){
+            const char *eol = memchr(p, '\n', end-p);
+            p = (eol) ? eol : end;
+        }else{                                      // '"'
+            const char *q = p+1;
+            while(q < end){
+                q = memchr(q, '"', end-q);
+                if(!q || q[-1] != '\\' || q == p+1)
+                    break;
+                q++;
+            }
+            p = (q && q < end) ? q+1 : p+1;
+        }
+    }
+
+    return end;
+}
+
+/* Copies a segment body up to and including its '}', replaces @variables
+   and drops comments. Returns the position after the closing brace */
+const char *ScanSegmentBody(const char *p, const char *end)
+{
+    char name[FILENAMEMAX+1];
+
+    while(p < end){
+        const char *q = ScanForSet(p, end, &SegmentSet, &LN);
+        if(q > p)
+            WriteSpanToFile(p, q-p);
+        if(q == end)
+            return end;
+
+        if(*q == '}'){
+            WriteSpanToFile(q, 1);
+            return q+1;
+        }else if(*q == ';'){
+            const char *eol = memchr(q, '\n', end-q);   // Newline itself is kept
+            p = (eol) ? eol : end;
+        }else{                                          // '@'
+            const char *r = q+1;
+            while( (r < end) && ( (*r >= 'a' && *r <= 'z') || (*r >= 'A' && *r <= 'Z') ||
+                                  (*r >= '0' && *r <= '9') || (*r == '_') ) )
+                r++;
+            if(r == q+1){
+                WriteSpanToFile(q, 1);
+                p = r;
+                continue;
+            }
+
+            char *var = ((size_t)(r-q) < sizeof(name)) ? name : malloc(r-q+1);
+            memcpy(var, q, r-q);
+            var[r-q] = '\0';
+            long int existence = CheckVariableExistence(var);
+            if(var != name)
+                free(var);
+            if(existence == -1)
+                yyerror("Variable is not defined");
+
+            WriteToFile(VariableTable[existence].value);
+            p = r;
+        }
+    }
+
+    return end;
+}
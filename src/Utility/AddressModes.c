@@ -0,0 +1,36 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdint.h>
+#include "../../include/Definitions.h"
+#include "../../include/Assembler.h"
+
+#define EA(mod, rm, disps, clocks) { (mod), (rm), (disps), (clocks) }
+
+/* ModR/M of every base, index and displacement class, used by the grammar of
+   both passes. Encoders and size functions read the displacement bytes back
+   from the operand instead of deriving them from mod and rm.
+
+   There is no 8-bit direct address and no [BP] without displacement, those
+   take the next wider class. [] alone is not an operand, its entry is the
+   direct address only to keep the table total */
+const AddrMode_t AddressModes[EA_BASES][EA_INDEXES][DISP_CLASSES] = {
+    [BASE_NONE] = {
+        [IDX_NONE]        = { EA(0, 6, 2, 6),  EA(0, 6, 2, 6),  EA(0, 6, 2, 6)  },    // [disp16]
+        [IDX_SOURCE]      = { EA(0, 4, 0, 5),  EA(1, 4, 1, 9),  EA(2, 4, 2, 9)  },    // [SI]
+        [IDX_DESTINATION] = { EA(0, 5, 0, 5),  EA(1, 5, 1, 9),  EA(2, 5, 2, 9)  },    // [DI]
+    },
+    [BASE_REG] = {
+        [IDX_NONE]        = { EA(0, 7, 0, 5),  EA(1, 7, 1, 9),  EA(2, 7, 2, 9)  },    // [BX]
+        [IDX_SOURCE]      = { EA(0, 0, 0, 7),  EA(1, 0, 1, 11), EA(2, 0, 2, 11) },    // [BX:SI]
+        [IDX_DESTINATION] = { EA(0, 1, 0, 8),  EA(1, 1, 1, 12), EA(2, 1, 2, 12) },    // [BX:DI]
+    },
+    [BASE_PTR] = {
+        [IDX_NONE]        = { EA(1, 6, 1, 9),  EA(1, 6, 1, 9),  EA(2, 6, 2, 9)  },    // [BP]
+        [IDX_SOURCE]      = { EA(0, 2, 0, 8),  EA(1, 2, 1, 12), EA(2, 2, 2, 12) },    // [BP:SI]
+        [IDX_DESTINATION] = { EA(0, 3, 0, 7),  EA(1, 3, 1, 11), EA(2, 3, 2, 11) },    // [BP:DI]
+    },
+};
@@ -0,0 +1,367 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#define ERROR_HANDLER
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include "../../include/Errors.h"
+#include "../../include/Definitions.h"
+
+#define COLOR_RESET "\033[0m"
+
+uint8_t errcode;
+
+/* Diagnostic Variables */
+static Diagnostic_t *Diags;
+static size_t diagsize, diagcap;
+static char *DiagPool;              // Text of the diagnostics, offset 0 is no text
+static size_t poolsize, poolcap;
+static LCounter_t DiagSeq;
+static LCounter_t LastKey;          // Line of the last diagnostic that named one
+static LCounter_t ErrorCount;
+static LCounter_t ErrorLimit;       // --max-errors, 0 for no limit
+static LCounter_t Suppressed;       // Errors over the limit, only counted
+static Flag_t FlushRegistered;
+static uint8_t DiagFormat;          // DIAGFORMAT_*
+static const char *DiagFile;        // Source the lines belong to, NULL if not named
+
+/* Names of the severities in JSON */
+static const char *SeverityNames[] = {
+    [DIAG_ERROR] = "error",
+    [DIAG_WARNING] = "warning",
+    [DIAG_NOTE] = "note"
+};
+
+/* Function Declerations */
+void PrintError(char *color, char *format, ...);
+void PrintWarning(char *format, ...);
+void InternalError(char *format, ...);
+void ExternalError(char *format, ...);
+void LimitDiagnostics(LCounter_t max);
+void FormatDiagnostics(uint8_t format);
+void NameDiagnosticsFile(const char *path);
+void FlushDiagnostics(void);
+static void Report(uint8_t severity, const char *color, uint8_t code, const char *dcolor, const char *detail, const char *format, va_list ArgList);
+static Boolean_t ReservePool(size_t len);
+static Boolean_t ReserveDiagnostic(void);
+static void PrintDiagnostic(FILE *file, const Diagnostic_t *diag);
+static void PrintDiagnosticJSON(FILE *file, const Diagnostic_t *diag);
+static void PutJSONFile(FILE *file);
+static void PutJSONString(FILE *file, const char *str, size_t len);
+static size_t TrimLine(const char *str);
+static int CompareDiagnostics(const void *a, const void *b);
+
+
+
+/* Function Definitions */
+
+// The color only changes how the error looks
+void PrintError(char *color, char *format, ...)
+{
+    va_list ArgList;
+    va_start(ArgList, format);
+    Report(DIAG_ERROR, color, ERR_SUCCESS, NULL, NULL, format, ArgList);
+    va_end(ArgList);
+}
+
+// Not counted as an error, the stage goes on
+void PrintWarning(char *format, ...)
+{
+    va_list ArgList;
+    va_start(ArgList, format);
+    Report(DIAG_WARNING, COLOR_BOLDYELLOW, ERR_SUCCESS, NULL, NULL, format, ArgList);
+    va_end(ArgList);
+}
+
+// The message of errcode follows in blue
+void InternalError(char *format, ...)
+{
+    va_list ArgList;
+    va_start(ArgList, format);
+    uint8_t code = (errcode < LENERRMSG) ? errcode : ERR_SUCCESS;
+    Report(DIAG_ERROR, COLOR_BOLDRED, code, COLOR_BLUE, ErrorMessages[code], format, ArgList);
+    va_end(ArgList);
+}
+
+// The reason of the failed call follows, as perror("") would print it
+void ExternalError(char *format, ...)
+{
+    const char *reason = strerror(errno);
+    va_list ArgList;
+    va_start(ArgList, format);
+    Report(DIAG_ERROR, COLOR_BOLDRED, ERR_SUCCESS, NULL, reason, format, ArgList);
+    va_end(ArgList);
+}
+
+void LimitDiagnostics(LCounter_t max)
+{
+    ErrorLimit = max;
+}
+
+void FormatDiagnostics(uint8_t format)
+{
+    DiagFormat = format;
+}
+
+// The diagnostics so far belong to the previous file, path must outlive them
+void NameDiagnosticsFile(const char *path)
+{
+    FlushDiagnostics();
+    DiagFile = path;
+}
+
+/* Prints every diagnostic of the stage sorted by line, in one write. Runs
+   at exit and before a fork, so a child does not print them again */
+void FlushDiagnostics(void)
+{
+    if( (diagsize == 0) && (Suppressed == 0) )
+        return;
+
+    qsort(Diags, diagsize, sizeof(Diagnostic_t), CompareDiagnostics);
+
+    char *buf = NULL;
+    size_t len = 0;
+    FILE *out = open_memstream(&buf, &len);
+    if(!out)
+        out = stderr;
+
+    size_t idx;
+    for(idx=0; idx<diagsize; idx++){
+        if(DiagFormat == DIAGFORMAT_JSON)
+            PrintDiagnosticJSON(out, &Diags[idx]);
+        else
+            PrintDiagnostic(out, &Diags[idx]);
+    }
+    if( (Suppressed > 0) && (DiagFormat == DIAGFORMAT_JSON) ){
+        PutJSONFile(out);
+        fprintf(out, ",\"line\":null,\"column\":null,\"severity\":\"note\",\"code\":null,"
+                     "\"message\":\"%u more errors were not shown, see --max-errors\"}\n", Suppressed);
+    }else if(Suppressed > 0)
+        fprintf(out, "%s%u more errors were not shown, see --max-errors\n" COLOR_RESET, COLOR_BOLDRED, Suppressed);
+
+    if(out != stderr){
+        fclose(out);
+        fwrite(buf, 1, len, stderr);
+        free(buf);
+    }
+    fflush(stderr);
+
+    free(Diags);
+    free(DiagPool);
+    Diags = NULL;
+    DiagPool = NULL;
+    diagsize = diagcap = 0;
+    poolsize = poolcap = 0;
+    Suppressed = 0;
+}
+
+/* Diagnostics are formatted once and kept, "Line %d" at the start of the
+   format takes the line from the arguments. A repeated message of the
+   same line is dropped, errors over the limit are only counted */
+static void Report(uint8_t severity, const char *color, uint8_t code, const char *dcolor, const char *detail, const char *format, va_list ArgList)
+{
+    if(FlushRegistered == NSET){
+        atexit(FlushDiagnostics);
+        FlushRegistered = SET;
+    }
+
+    if( (severity == DIAG_ERROR) && (ErrorLimit > 0) && (ErrorCount >= ErrorLimit) ){
+        Suppressed++;
+        return;
+    }
+
+    va_list Saved;
+    va_copy(Saved, ArgList);
+
+    LCounter_t line = 0;
+    const char *rest = format;
+    if(strncmp(format, "Line %d", 7) == 0){
+        line = va_arg(ArgList, LCounter_t);
+        rest = format+7;
+    }
+
+    va_list Sizing;
+    va_copy(Sizing, ArgList);
+    int restlen = vsnprintf(NULL, 0, rest, Sizing);
+    va_end(Sizing);
+    int prefixlen = (rest != format) ? snprintf(NULL, 0, "Line %u", line) : 0;
+    size_t detaillen = detail ? strlen(detail)+1 : 0;   // A detail ends its line
+
+    if( (restlen < 0) || (ReserveDiagnostic() == FALSE) || (ReservePool(prefixlen+restlen+detaillen+2) == FALSE) ){
+        // Out of memory, printed as it comes
+        fprintf(stderr, "%s", color);
+        vfprintf(stderr, format, Saved);
+        fprintf(stderr, COLOR_RESET);
+        if(detail)
+            fprintf(stderr, "%s%s\n" COLOR_RESET, dcolor ? dcolor : "", detail);
+        va_end(Saved);
+        return;
+    }
+    va_end(Saved);
+
+    size_t start = poolsize;
+    Diagnostic_t *diag = &Diags[diagsize];
+    diag->line = line;
+    diag->key = (line > 0) ? line : LastKey;
+    diag->severity = severity;
+    diag->code = code;
+    diag->color = color;
+    diag->dcolor = dcolor;
+    diag->text = poolsize;
+    if(rest != format)
+        poolsize += sprintf(DiagPool+poolsize, "Line %u", line);
+    vsprintf(DiagPool+poolsize, rest, ArgList);
+    diag->msg = poolsize;
+    if(rest != format)
+        diag->msg += (strncmp(rest, " :: ", 4) == 0) ? 4 : (strncmp(rest, ", ", 2) == 0) ? 2 : 0;
+    poolsize += restlen+1;
+
+    diag->detail = 0;
+    if(detail){
+        diag->detail = poolsize;
+        poolsize += sprintf(DiagPool+poolsize, "%s", detail);
+        if( (poolsize == diag->detail) || (DiagPool[poolsize-1] != '\n') )
+            DiagPool[poolsize++] = '\n';
+        DiagPool[poolsize++] = '\0';
+    }
+
+    // Reports of a line come one after another
+    size_t idx;
+    for(idx=diagsize; (line > 0) && (idx > 0) && (Diags[idx-1].line == line); idx--){
+        const Diagnostic_t *prev = &Diags[idx-1];
+        if( (strcmp(DiagPool+prev->text, DiagPool+diag->text) == 0) &&
+            (strcmp(DiagPool+prev->detail, DiagPool+diag->detail) == 0) ){
+            poolsize = start;
+            return;
+        }
+    }
+
+    diag->seq = DiagSeq++;
+    if(line > 0)
+        LastKey = line;
+    if(severity == DIAG_ERROR)
+        ErrorCount++;
+    diagsize++;
+}
+
+static Boolean_t ReservePool(size_t len)
+{
+    size_t need = poolsize+len + (DiagPool ? 0 : 1);     // Offset 0 is the empty text
+    if(need <= poolcap)
+        return TRUE;
+    size_t cap = poolcap ? poolcap : DIAGPOOL_INITCAP;
+    while(need > cap)
+        cap <<= 1;
+    char *tmp = realloc(DiagPool, cap);
+    if(!tmp)
+        return FALSE;
+    if(!DiagPool){
+        tmp[0] = '\0';
+        poolsize = 1;
+    }
+    DiagPool = tmp;
+    poolcap = cap;
+    return TRUE;
+}
+
+static Boolean_t ReserveDiagnostic(void)
+{
+    if(diagsize < diagcap)
+        return TRUE;
+    size_t cap = diagcap ? (diagcap << 1) : DIAG_INITCAP;
+    Diagnostic_t *tmp = realloc(Diags, cap*sizeof(Diagnostic_t));
+    if(!tmp)
+        return FALSE;
+    Diags = tmp;
+    diagcap = cap;
+    return TRUE;
+}
+
+static void PrintDiagnostic(FILE *file, const Diagnostic_t *diag)
+{
+    fprintf(file, "%s%s" COLOR_RESET, diag->color, DiagPool+diag->text);
+    if(diag->detail == 0)
+        return;
+    if(diag->dcolor)
+        fprintf(file, "%s%s" COLOR_RESET, diag->dcolor, DiagPool+diag->detail);
+    else
+        fputs(DiagPool+diag->detail, file);
+}
+
+/* {"file","line","column","severity","code","message"} on one line, no
+   colors. Lines and columns are null when unknown, the scanners keep no
+   columns. The message is the text after "Line %d :: " with its detail */
+static void PrintDiagnosticJSON(FILE *file, const Diagnostic_t *diag)
+{
+    PutJSONFile(file);
+    if(diag->line > 0)
+        fprintf(file, ",\"line\":%u", diag->line);
+    else
+        fprintf(file, ",\"line\":null");
+    fprintf(file, ",\"column\":null,\"severity\":\"%s\",\"code\":", SeverityNames[diag->severity]);
+    if( (diag->code != ERR_SUCCESS) && ErrorNames[diag->code] && (ErrorNames[diag->code][0] != '\0') )
+        fprintf(file, "\"%s\"", ErrorNames[diag->code]);
+    else
+        fprintf(file, "null");
+
+    // One string of the message and its detail
+    const char *msg = DiagPool+diag->msg;
+    const char *detail = DiagPool+diag->detail;
+    size_t msglen = TrimLine(msg);
+    size_t detaillen = TrimLine(detail);
+    fprintf(file, ",\"message\":\"");
+    PutJSONString(file, msg, msglen);
+    PutJSONString(file, detail, detaillen);
+    fprintf(file, "\"}\n");
+}
+
+// {"file": of every object
+static void PutJSONFile(FILE *file)
+{
+    fprintf(file, "{\"file\":");
+    if(DiagFile){
+        putc('"', file);
+        PutJSONString(file, DiagFile, strlen(DiagFile));
+        putc('"', file);
+    }else
+        fprintf(file, "null");
+}
+
+// Quotes are left to the caller when a string is written in parts
+static void PutJSONString(FILE *file, const char *str, size_t len)
+{
+    size_t idx;
+    for(idx=0; idx<len; idx++){
+        if( (str[idx] == '"') || (str[idx] == '\\') )
+            fprintf(file, "\\%c", str[idx]);
+        else if( (uint8_t) str[idx] < 0x20 )
+            fprintf(file, "\\u%04x", (uint8_t) str[idx]);
+        else
+            putc(str[idx], file);
+    }
+}
+
+// Length without the newlines that end the text
+static size_t TrimLine(const char *str)
+{
+    size_t len = strlen(str);
+    while( (len > 0) && (str[len-1] == '\n') )
+        len--;
+    return len;
+}
+
+static int CompareDiagnostics(const void *a, const void *b)
+{
+    const Diagnostic_t *x = a;
+    const Diagnostic_t *y = b;
+    if(x->key != y->key)
+        return (x->key < y->key) ? -1 : 1;
+    return (x->seq < y->seq) ? -1 : (x->seq > y->seq);
+}
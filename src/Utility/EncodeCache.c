@@ -0,0 +1,106 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Assembler.h"
+
+/* Cache Variables */
+static EncodeEntry_t EncodeCache[ENCODE_CACHE_SIZE];
+static EncodeEntry_t *Pending;      // Slot of the last miss, filled when it encodes
+LCounter_t EncodeHits;
+LCounter_t EncodeMisses;
+LCounter_t EncodeBypasses;          // Operands naming a symbol
+
+extern Flag_t isSOP;                // Is segment is overwridden
+extern uint8_t SOP;                 // Overridden Segment
+
+/* Output Functions */
+extern Boolean_t EmitInsn(const InsnBytes_t *insn);
+
+/* Function Declerations */
+Boolean_t LookupEncoding(uint8_t family, uint8_t mode, uint8_t inst, const Operand_t *op);
+Boolean_t CacheInsn(const InsnBytes_t *insn);
+void PrintEncodeStats(FILE *file);
+static LCounter_t HashKey(const EncodeKey_t *key);
+
+
+
+/* Function Definitions */
+
+/* Called by an encoder before it looks at its operands. On a hit the cached
+   bytes are emitted and the encoder returns at once, on a miss the slot is
+   kept for CacheInsn(). Symbols are resolved differently in every line and
+   their references are located in the output, so they are never cached */
+Boolean_t LookupEncoding(uint8_t family, uint8_t mode, uint8_t inst, const Operand_t *op)
+{
+    Pending = NULL;
+    if( (op[0].isSym == TRUE) || (op[1].isSym == TRUE) ){
+        EncodeBypasses++;
+        return FALSE;
+    }
+
+    EncodeKey_t key;
+    key.family = family;
+    key.mode = mode;
+    key.inst = inst;
+    key.sop = (isSOP == SET) ? SOP + 1 : 0;
+    memcpy(key.op, op, sizeof(key.op));
+
+    EncodeEntry_t *entry = &EncodeCache[HashKey(&key)];
+    if( (entry->valid == TRUE) && (memcmp(&entry->key, &key, sizeof(EncodeKey_t)) == 0) ){
+        EncodeHits++;
+        if(entry->keepsop == NSET)
+            isSOP = NSET;
+        EmitInsn(&entry->insn);
+        return TRUE;
+    }
+
+    EncodeMisses++;
+    entry->valid = FALSE;
+    entry->key = key;
+    Pending = entry;
+    return FALSE;
+}
+
+// Replaces EmitInsn() at the end of an encoder, errors never reach it
+Boolean_t CacheInsn(const InsnBytes_t *insn)
+{
+    if(Pending){
+        Pending->insn = *insn;
+        Pending->keepsop = isSOP;
+        Pending->valid = TRUE;
+        Pending = NULL;
+    }
+    return EmitInsn(insn);
+}
+
+// --stats, after pass 2
+void PrintEncodeStats(FILE *file)
+{
+    LCounter_t lookups = EncodeHits + EncodeMisses;
+    fprintf(file, "Encoding cache: %u hits, %u misses, %u with symbols", EncodeHits, EncodeMisses, EncodeBypasses);
+    if(lookups > 0)
+        fprintf(file, ", %u%% hit rate", (LCounter_t) ( (100ULL*EncodeHits) / lookups ));
+    fprintf(file, "\n");
+}
+
+// FNV-1a over the key, folded to the slot index
+static LCounter_t HashKey(const EncodeKey_t *key)
+{
+    const uint8_t *byte = (const uint8_t *) key;
+    LCounter_t hash = 2166136261u;
+    size_t idx;
+    for(idx=0; idx<sizeof(EncodeKey_t); idx++){
+        hash ^= byte[idx];
+        hash *= 16777619u;
+    }
+    return (hash ^ (hash >> ENCODE_CACHE_BITS)) & (ENCODE_CACHE_SIZE-1);
+}
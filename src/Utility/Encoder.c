@@ -16,7 +16,7 @@
 extern Boolean_t erroneous;                // Is there any error?
 extern Fname_t SrcFile;                    // Source File to be scanned/parsed
 extern LCounter_t LN;                      // Line Number
-extern MCounter_t LC;                      // Global Location Counter
+extern LCounter_t LC;                      // Global Location Counter
 extern Flag_t isORG;                       // Is ORG directive used
 extern Flag_t isSOP;                       // Is segment is overwridden
 extern uint8_t SOP;                        // Overridden Segment
@@ -38,177 +38,179 @@ extern SCounter_t CalculateSize(short int val);         // Calculate the size of
 extern Boolean_t CheckSignExtension(short int val);     // Check a number if it's sign extended
 extern void ExitSafely(int retcode);                    // Safe Exit Function
 
-/* Function Declerations */
-extern void WriteByte2File(uint8_t byte);
+/* Output Functions */
+extern Boolean_t EmitInsn(const InsnBytes_t *insn);
+extern Boolean_t LookupEncoding(uint8_t family, uint8_t mode, uint8_t inst, const Operand_t *op);   // Emits a cached encoding
+extern Boolean_t CacheInsn(const InsnBytes_t *insn);                                                // Emits and caches a new one
 
-Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm);  // ADC, ADD, AND, CMP, OR, SBB, SUB, XOR
-Boolean_t EncodeMov(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm, uint8_t sreg);              // MOV
-Boolean_t EncodeStackBlock(uint8_t mode, uint8_t inst, Register_t reg, uint8_t sreg, Memory_t mem);                            // POP, PUSH
-Boolean_t EncodeIOBlock(uint8_t mode, uint8_t inst, Register_t reg, Immediate_t imm);                                          // INB, INW, OUTB, OUTW
-Boolean_t EncodeXchg(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem);                                            // XCHG
-Boolean_t EncodeAddressBlock(uint8_t inst, Register_t reg, Memory_t mem);                                                      // LEA, LES, LDS
-Boolean_t EncodeShiftRotateBlock(uint8_t mode, uint8_t inst, Register_t regd, Register_t regs, Memory_t mem);                  // RCL, RCR, ROL, ROR, SAL, SAR, SHL, SHR
-Boolean_t EncodeInterrupt(Immediate_t imm);                                                                                    // INT
-Boolean_t EncodeReturnBlock(uint8_t mode, uint8_t inst, Immediate_t imm);                                                      // RETN, RETF
-Boolean_t EncodeTest(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm);                           // TEST
-Boolean_t EncodeArithmetic2Block(uint8_t mode, uint8_t inst, Register_t reg, Memory_t mem);                                    // DIV, IDIV, MUL, IMUL, NEG, NOT
-Boolean_t EncodeIncDecBlock(uint8_t mode, uint8_t inst, Register_t reg, Memory_t mem);                                         // INC, DEC
+/* Function Declerations */
+Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                              // ADC, ADD, AND, CMP, OR, SBB, SUB, XOR
+Boolean_t EncodeMov(uint8_t mode, const Operand_t *op);                                                                        // MOV
+Boolean_t EncodeStackBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                                   // POP, PUSH
+Boolean_t EncodeIOBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                                      // INB, INW, OUTB, OUTW
+Boolean_t EncodeXchg(uint8_t mode, const Operand_t *op);                                                                       // XCHG
+Boolean_t EncodeAddressBlock(uint8_t inst, const Operand_t *op);                                                               // LEA, LES, LDS
+Boolean_t EncodeShiftRotateBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                             // RCL, RCR, ROL, ROR, SAL, SAR, SHL, SHR
+Boolean_t EncodeInterrupt(const Operand_t *op);                                                                                // INT
+Boolean_t EncodeReturnBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                                  // RETN, RETF
+Boolean_t EncodeTest(uint8_t mode, const Operand_t *op);                                                                       // TEST
+Boolean_t EncodeArithmetic2Block(uint8_t mode, uint8_t inst, const Operand_t *op);                                             // DIV, IDIV, MUL, IMUL, NEG, NOT
+Boolean_t EncodeIncDecBlock(uint8_t mode, uint8_t inst, const Operand_t *op);                                                  // INC, DEC
 Boolean_t EncodeSingleByteInst(uint8_t byte);
 Boolean_t EncodeTwoByteInst(uint8_t byte1, uint8_t byte2);
-Boolean_t EncodeJccBlock(uint8_t byte1, Immediate_t imm);
-Boolean_t EncodeFarOp(uint8_t mode, uint8_t inst, Memory_t mem, Immediate_t imm1, Immediate_t imm2);                           // JMPF, CALLF
-Boolean_t EncodeNearOp(uint8_t mode, uint8_t inst, Register_t reg, Memory_t mem, Immediate_t imm);                             // JMPN, CALLN
+Boolean_t EncodeJccBlock(uint8_t byte1, const Operand_t *op);
+Boolean_t EncodeFarOp(uint8_t mode, uint8_t inst, const Operand_t *op);                                                        // JMPF, CALLF
+Boolean_t EncodeNearOp(uint8_t mode, uint8_t inst, const Operand_t *op);                                                       // JMPN, CALLN
 
 Boolean_t EncodeEscapeBlock(void);                                                                                             // ESC0-7
+Boolean_t EncodeRecord(const IRRecord_t *ir);                                                                                  // Instruction sized by pass 1
 
 /* Function Definitions */
-Boolean_t EncodeMov(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm, uint8_t sreg)
+Boolean_t EncodeMov(uint8_t mode, const Operand_t *op)
 {
+    const Operand_t *regd = &op[0], *regs = &op[1];
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
+    uint8_t sreg = OPERAND(op, OPERAND_SREG)->id;
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_MOV, mode, 0, op) == TRUE)
+        return TRUE;
     switch(mode){
         case MODE_REG_REG:
-            if( (regd.size == SZ_BYTE) && (regs.size == SZ_BYTE) ){              // Reg8, Reg8
-                SegmentTable[stsize-1].LC += 2;
+            if( (regd->size == SZ_BYTE) && (regs->size == SZ_BYTE) ){              // Reg8, Reg8
                 uint8_t byte1 = 0b10001000;
-                uint8_t byte2 = 0b11000000 | (regs.id << 3) | regd.id;
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
-            }else if( (regd.size == SZ_WORD) && (regs.size == SZ_WORD) ){      // Reg16, Reg16
-                SegmentTable[stsize-1].LC += 2;
+                uint8_t byte2 = 0b11000000 | (regs->id << 3) | regd->id;
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
+            }else if( (regd->size == SZ_WORD) && (regs->size == SZ_WORD) ){      // Reg16, Reg16
                 uint8_t byte1 = 0b10001001;
-                uint8_t byte2 = 0b11000000 | (regs.id << 3) | regd.id;
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
+                uint8_t byte2 = 0b11000000 | (regs->id << 3) | regd->id;
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
             }
             break;
         case MODE_REG_MEM:
-            if( (mem.size == SZ_BYTE) &&(regd.size == SZ_BYTE) ){
-                if( (mem.mod == 0) && (mem.rm == 6) && (regd.id == GPR_ALAX) ){     // Acc8, Mem8
+            if( (mem->size == SZ_BYTE) &&(regd->size == SZ_BYTE) ){
+                if( (mem->mod == 0) && (mem->rm == 6) && (regd->id == GPR_ALAX) ){     // Acc8, Mem8
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xA0;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        INSN_PUT(insn, byte4);
                     }else{
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = 0xA0;
-                        uint8_t byte2 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte3 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte2 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte3 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_DISP(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }
                 }else{
-                    if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){      // Reg8, Mem8
+                    if( mem->disps > 0 ){                                             // Reg8, Mem8
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 5;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x8A;
-                            uint8_t byte3 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                            uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
+                            uint8_t byte3 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                            uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_DISP(insn, byte4);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte5);
                         }else{
-                            SegmentTable[stsize-1].LC += 4;
                             uint8_t byte1 = 0xA0;
-                            uint8_t byte2 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                            uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
+                            uint8_t byte2 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                            uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_DISP(insn, byte3);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte4);
                         }
                     }else{
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 3;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x8A;
-                            uint8_t byte3 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
+                            uint8_t byte3 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
                         }else{
-                            SegmentTable[stsize-1].LC += 2;
                             uint8_t byte1 = 0xA0;
-                            uint8_t byte2 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
+                            uint8_t byte2 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
                         }
                     }
                 }
-            }else if( (mem.size == SZ_WORD) && (regd.size == SZ_WORD) ){
-                if( (mem.mod == 0) && (mem.rm == 6) && (regd.id == GPR_ALAX) ){     // Acc16, Mem16
+            }else if( (mem->size == SZ_WORD) && (regd->size == SZ_WORD) ){
+                if( (mem->mod == 0) && (mem->rm == 6) && (regd->id == GPR_ALAX) ){     // Acc16, Mem16
                     if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 4;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0xA1;
-                            uint8_t byte3 = (uint8_t) ( mem.disp & 0x00FF );
-                            uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
+                            uint8_t byte3 = (uint8_t) ( mem->val & 0x00FF );
+                            uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_DISP(insn, byte3);
+                            INSN_PUT(insn, byte4);
                         }else{
-                            SegmentTable[stsize-1].LC += 3;
                             uint8_t byte1 = 0xA1;
-                            uint8_t byte2 = (uint8_t) ( mem.disp & 0x00FF );
-                            uint8_t byte3 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
+                            uint8_t byte2 = (uint8_t) ( mem->val & 0x00FF );
+                            uint8_t byte3 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_DISP(insn, byte2);
+                            INSN_PUT(insn, byte3);
                         }
                 }else{
-                    if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){      // Reg16, Mem16
+                    if( mem->disps > 0 ){                                             // Reg16, Mem16
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 5;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x8B;
-                            uint8_t byte3 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                            uint8_t byte4 = (uint8_t) ( mem.disp & 0x00FF );
-                            uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
+                            uint8_t byte3 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                            uint8_t byte4 = (uint8_t) ( mem->val & 0x00FF );
+                            uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_DISP(insn, byte4);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte5);
                         }else{
-                            SegmentTable[stsize-1].LC += 4;
                             uint8_t byte1 = 0x8B;
-                            uint8_t byte2 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                            uint8_t byte3 = (uint8_t) ( mem.disp & 0x00FF );
-                            uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
+                            uint8_t byte2 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                            uint8_t byte3 = (uint8_t) ( mem->val & 0x00FF );
+                            uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_DISP(insn, byte3);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte4);
                         }
                     }else{
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 3;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x8B;
-                            uint8_t byte3 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
+                            uint8_t byte3 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
                         }else{
-                            SegmentTable[stsize-1].LC += 2;
                             uint8_t byte1 = 0x8B;
-                            uint8_t byte2 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
+                            uint8_t byte2 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
                         }
                     }
                 }
@@ -221,131 +223,123 @@ Boolean_t EncodeMov(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem
                 isSOP = NSET;
             break;
         case MODE_MEM_REG:
-            if( (mem.size == SZ_BYTE) && (regs.size == SZ_BYTE) ){
-                if( (mem.mod == 0) && (mem.rm == 6) && (regs.id == GPR_ALAX) ){
+            if( (mem->size == SZ_BYTE) && (regs->size == SZ_BYTE) ){
+                if( (mem->mod == 0) && (mem->rm == 6) && (regs->id == GPR_ALAX) ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xA2;
-                        uint8_t byte3 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte3 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        INSN_PUT(insn, byte4);
                     }else{
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = 0xA2;
-                        uint8_t byte2 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte3 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte2 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte3 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_DISP(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }
                 }else{
-                    if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){      // Reg16, Mem16
+                    if( mem->disps > 0 ){                                             // Reg16, Mem16
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 5;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x88;
-                            uint8_t byte3 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                            uint8_t byte4 = (uint8_t) ( mem.disp & 0x00FF );
-                            uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
+                            uint8_t byte3 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                            uint8_t byte4 = (uint8_t) ( mem->val & 0x00FF );
+                            uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_DISP(insn, byte4);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte5);
                         }else{
-                            SegmentTable[stsize-1].LC += 4;
                             uint8_t byte1 = 0x88;
-                            uint8_t byte2 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                            uint8_t byte3 = (uint8_t) ( mem.disp & 0x00FF );
-                            uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
+                            uint8_t byte2 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                            uint8_t byte3 = (uint8_t) ( mem->val & 0x00FF );
+                            uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_DISP(insn, byte3);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte4);
                         }
                     }else{
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 3;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x88;
-                            uint8_t byte3 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
+                            uint8_t byte3 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
                         }else{
-                            SegmentTable[stsize-1].LC += 2;
                             uint8_t byte1 = 0x88;
-                            uint8_t byte2 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
+                            uint8_t byte2 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
                         }
                     }
                 }
-            }else if( (mem.size == SZ_WORD) && (regs.size == SZ_WORD) ){
-                if( (mem.mod == 0) && (mem.rm == 6) && (regs.id == GPR_ALAX) ){     // Acc16, Mem16
+            }else if( (mem->size == SZ_WORD) && (regs->size == SZ_WORD) ){
+                if( (mem->mod == 0) && (mem->rm == 6) && (regs->id == GPR_ALAX) ){     // Acc16, Mem16
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xA3;
-                        uint8_t byte3 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte3 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        INSN_PUT(insn, byte4);
                     }else{
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = 0xA3;
-                        uint8_t byte2 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte3 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte2 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte3 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_DISP(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }
                 }else{
-                    if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){      // Reg16, Mem16
+                    if( mem->disps > 0 ){                                             // Reg16, Mem16
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 5;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x89;
-                            uint8_t byte3 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                            uint8_t byte4 = (uint8_t) ( mem.disp & 0x00FF );
-                            uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
+                            uint8_t byte3 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                            uint8_t byte4 = (uint8_t) ( mem->val & 0x00FF );
+                            uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_DISP(insn, byte4);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte5);
                         }else{
-                            SegmentTable[stsize-1].LC += 4;
                             uint8_t byte1 = 0x89;
-                            uint8_t byte2 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                            uint8_t byte3 = (uint8_t) ( mem.disp & 0x00FF );
-                            uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
+                            uint8_t byte2 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                            uint8_t byte3 = (uint8_t) ( mem->val & 0x00FF );
+                            uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_DISP(insn, byte3);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte4);
                         }
                     }else{
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 3;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x89;
-                            uint8_t byte3 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
+                            uint8_t byte3 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
                         }else{
-                            SegmentTable[stsize-1].LC += 2;
                             uint8_t byte1 = 0x89;
-                            uint8_t byte2 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
+                            uint8_t byte2 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
                         }
                     }
                 }
@@ -358,132 +352,126 @@ Boolean_t EncodeMov(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem
                 isSOP = NSET;
             break;
         case MODE_REG_IMM:
-            if( (regd.size == SZ_BYTE) && (imm.size == SZ_BYTE) ){
-                SegmentTable[stsize-1].LC += 2;
-                uint8_t byte1 = 0b10110000 | regd.id;
-                uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
-            }else if( (regd.size == SZ_WORD) && ( (imm.size == SZ_BYTE) || (imm.size == SZ_WORD) ) ){
-                SegmentTable[stsize-1].LC += 3;
-                uint8_t byte1 = 0b10111000 | regd.id;
-                uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
-                uint8_t byte3 = (imm.size == SZ_BYTE) ? 0 : (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
-                WriteByte2File(byte3);
+            if( (regd->size == SZ_BYTE) && (imm->size == SZ_BYTE) ){
+                uint8_t byte1 = 0b10110000 | regd->id;
+                uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
+                INSN_PUT(insn, byte1);
+                INSN_IMM(insn, byte2);
+            }else if( (regd->size == SZ_WORD) && ( (imm->size == SZ_BYTE) || (imm->size == SZ_WORD) ) ){
+                uint8_t byte1 = 0b10111000 | regd->id;
+                uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
+                uint8_t byte3 = (imm->size == SZ_BYTE) ? 0 : (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                INSN_PUT(insn, byte1);
+                INSN_IMM(insn, byte2);
+                INSN_PUT(insn, byte3);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
             }
             break;
         case MODE_MEM_IMM:
-            if( (mem.size == SZ_BYTE) && (imm.size == SZ_BYTE) ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){
+            if( (mem->size == SZ_BYTE) && (imm->size == SZ_BYTE) ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 6;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xC6;
-                        uint8_t byte3 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte4 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        uint8_t byte6 = (uint8_t) ( imm.val & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
-                        WriteByte2File(byte6);
+                        uint8_t byte3 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte4 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        uint8_t byte6 = (uint8_t) ( imm->val & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
+                        INSN_IMM(insn, byte6);
                     }else{
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = 0xC6;
-                        uint8_t byte2 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte3 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        uint8_t byte5 = (uint8_t) ( imm.val & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte2 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte3 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        uint8_t byte5 = (uint8_t) ( imm->val & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
+                        INSN_IMM(insn, byte5);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xC6;
-                        uint8_t byte3 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte4 = (uint8_t) ( imm.val & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte3 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte4 = (uint8_t) ( imm->val & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_IMM(insn, byte4);
                     }else{
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = 0xC6;
-                        uint8_t byte2 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte3 = (uint8_t) ( imm.val & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte2 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte3 = (uint8_t) ( imm->val & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_IMM(insn, byte3);
                     }
                 }
-            }else if( (mem.size == SZ_WORD) && ( (imm.size == SZ_BYTE) || (imm.size == SZ_WORD) ) ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){
+            }else if( (mem->size == SZ_WORD) && ( (imm->size == SZ_BYTE) || (imm->size == SZ_WORD) ) ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 7;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xC7;
-                        uint8_t byte3 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte4 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        uint8_t byte6 = (uint8_t) ( imm.val & 0x00FF );
-                        uint8_t byte7 = (imm.size == SZ_BYTE) ? 0 : (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
-                        WriteByte2File(byte6);
-                        WriteByte2File(byte7);
+                        uint8_t byte3 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte4 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        uint8_t byte6 = (uint8_t) ( imm->val & 0x00FF );
+                        uint8_t byte7 = (imm->size == SZ_BYTE) ? 0 : (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
+                        INSN_IMM(insn, byte6);
+                        INSN_PUT(insn, byte7);
                     }else{
-                        SegmentTable[stsize-1].LC += 6;
                         uint8_t byte1 = 0xC7;
-                        uint8_t byte2 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte3 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        uint8_t byte5 = (uint8_t) ( imm.val & 0x00FF );
-                        uint8_t byte6 = (imm.size == SZ_BYTE) ? 0 : (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
-                        WriteByte2File(byte6);
+                        uint8_t byte2 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte3 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        uint8_t byte5 = (uint8_t) ( imm->val & 0x00FF );
+                        uint8_t byte6 = (imm->size == SZ_BYTE) ? 0 : (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
+                        INSN_IMM(insn, byte5);
+                        INSN_PUT(insn, byte6);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xC7;
-                        uint8_t byte3 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte4 = (uint8_t) ( imm.val & 0x00FF );
-                        uint8_t byte5 = (imm.size == SZ_BYTE) ? 0 : (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte4 = (uint8_t) ( imm->val & 0x00FF );
+                        uint8_t byte5 = (imm->size == SZ_BYTE) ? 0 : (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_IMM(insn, byte4);
+                        INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = 0xC7;
-                        uint8_t byte2 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte3 = (uint8_t) ( imm.val & 0x00FF );
-                        uint8_t byte4 = (imm.size == SZ_BYTE) ? 0 : (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte3 = (uint8_t) ( imm->val & 0x00FF );
+                        uint8_t byte4 = (imm->size == SZ_BYTE) ? 0 : (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_IMM(insn, byte3);
+                        INSN_PUT(insn, byte4);
                     }
                 }
             }else{
@@ -495,58 +483,55 @@ Boolean_t EncodeMov(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem
                 isSOP = NSET;
             break;
         case MODE_SREG_REG:
-            if(regs.size == SZ_WORD){
-                SegmentTable[stsize-1].LC += 2;
+            if(regs->size == SZ_WORD){
                 uint8_t byte1 = 0x8E;
-                uint8_t byte2 = 0b11000000 | (sreg << 5) | regs.id;
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
+                uint8_t byte2 = 0b11000000 | (sreg << 5) | regs->id;
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
             }
             break;
         case MODE_SREG_MEM:
-            if( mem.size == SZ_WORD ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){
+            if( mem->size == SZ_WORD ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0x8E;
-                        uint8_t byte3 = (mem.mod << 6) | (sreg << 5) | mem.rm;
-                        uint8_t byte4 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (mem->mod << 6) | (sreg << 5) | mem->rm;
+                        uint8_t byte4 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = 0x8E;
-                        uint8_t byte2 = (mem.mod << 6) | (sreg << 5) | mem.rm;
-                        uint8_t byte3 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (mem->mod << 6) | (sreg << 5) | mem->rm;
+                        uint8_t byte3 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0x8E;
-                        uint8_t byte3 = (mem.mod << 6) | (sreg << 5) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte3 = (mem->mod << 6) | (sreg << 5) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
                         uint8_t byte1 = 0x8E;
-                        uint8_t byte2 = (mem.mod << 6) | (sreg << 5) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte2 = (mem->mod << 6) | (sreg << 5) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -558,58 +543,55 @@ Boolean_t EncodeMov(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem
                 isSOP = NSET;
             break;
         case MODE_REG_SREG:
-            if(regd.size == SZ_WORD){
-                SegmentTable[stsize-1].LC += 2;
+            if(regd->size == SZ_WORD){
                 uint8_t byte1 = 0x8C;
-                uint8_t byte2 = 0b11000000 | (sreg << 5) | regd.id;
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
+                uint8_t byte2 = 0b11000000 | (sreg << 5) | regd->id;
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
             }
             break;
         case MODE_MEM_SREG:
-            if( mem.size == SZ_WORD ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){
+            if( mem->size == SZ_WORD ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0x8C;
-                        uint8_t byte3 = (mem.mod << 6) | (sreg << 5) | mem.rm;
-                        uint8_t byte4 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (mem->mod << 6) | (sreg << 5) | mem->rm;
+                        uint8_t byte4 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = 0x8C;
-                        uint8_t byte2 = (mem.mod << 6) | (sreg << 5) | mem.rm;
-                        uint8_t byte3 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (mem->mod << 6) | (sreg << 5) | mem->rm;
+                        uint8_t byte3 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0x8C;
-                        uint8_t byte3 = (mem.mod << 6) | (sreg << 5) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte3 = (mem->mod << 6) | (sreg << 5) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
                         uint8_t byte1 = 0x8C;
-                        uint8_t byte2 = (mem.mod << 6) | (sreg << 5) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte2 = (mem->mod << 6) | (sreg << 5) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -626,19 +608,25 @@ Boolean_t EncodeMov(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem
             break;
     }
 
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeStackBlock(uint8_t mode, uint8_t inst, Register_t reg, uint8_t sreg, Memory_t mem)
+Boolean_t EncodeStackBlock(uint8_t mode, uint8_t inst, const Operand_t *op)
 {
-    printf("Mod: %d, Rm: %d, Reg: %d\n", mem.mod, mem.rm, reg.id);
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    uint8_t sreg = OPERAND(op, OPERAND_SREG)->id;
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_STACK, mode, inst, op) == TRUE)
+        return TRUE;
+    printf("Mod: %d, Rm: %d, Reg: %d\n", mem->mod, mem->rm, reg->id);
     switch(mode){
         case MODE_REG:
-            if(reg.size == SZ_WORD){
-                SegmentTable[stsize-1].LC += 1;
+            if(reg->size == SZ_WORD){
                 uint8_t byte1 = (inst == PUSH_INST) ? 0b01010000 : 0b01011000;
-                byte1 = byte1 | reg.id;
-                WriteByte2File(byte1);
+                byte1 = byte1 | reg->id;
+                INSN_PUT(insn, byte1);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand Size Mismatch!\n", LN);
                 return FALSE;
@@ -646,14 +634,12 @@ Boolean_t EncodeStackBlock(uint8_t mode, uint8_t inst, Register_t reg, uint8_t s
             break;
         case MODE_SREG:
             if(inst == PUSH_INST){
-                SegmentTable[stsize-1].LC += 1;
                 uint8_t byte1 = 0b00000110 | (sreg << 3);
-                WriteByte2File(byte1);
+                INSN_PUT(insn, byte1);
             }else{
                 if( sreg != SREG_CODE ){
-                    SegmentTable[stsize-1].LC += 1;
                     uint8_t byte1 = 0b00000111 | (sreg << 3);
-                    WriteByte2File(byte1);
+                    INSN_PUT(insn, byte1);
                 }else{
                     PrintError(COLOR_BOLDRED, "Line %d :: CS is illegal with POP instruction!\n", LN);
                     return FALSE;
@@ -661,50 +647,48 @@ Boolean_t EncodeStackBlock(uint8_t mode, uint8_t inst, Register_t reg, uint8_t s
             }
             break;
         case MODE_MEM:
-            if(mem.size == SZ_WORD){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){
+            if(mem->size == SZ_WORD){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = (inst == PUSH_INST) ? 0xFF : 0x8F;
-                        uint8_t byte3 = (inst == POP_INST) ? ((mem.mod << 6) | mem.rm) : ((mem.mod << 6) | 0b00110000 | mem.rm);
-                        uint8_t byte4 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
-                        printf("Mod: %d, Rm: %d, Reg: %d\n", mem.mod, mem.rm, reg.id);
+                        uint8_t byte3 = (inst == POP_INST) ? ((mem->mod << 6) | mem->rm) : ((mem->mod << 6) | 0b00110000 | mem->rm);
+                        uint8_t byte4 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
+                        printf("Mod: %d, Rm: %d, Reg: %d\n", mem->mod, mem->rm, reg->id);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = (inst == PUSH_INST) ? 0xFF : 0x8F;
-                        uint8_t byte2 = (inst == POP_INST) ? ((mem.mod << 6) | mem.rm) : ((mem.mod << 6) | 0b00110000 | mem.rm);
-                        uint8_t byte3 = (uint8_t) ( mem.disp & 0x00FF );
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (inst == POP_INST) ? ((mem->mod << 6) | mem->rm) : ((mem->mod << 6) | 0b00110000 | mem->rm);
+                        uint8_t byte3 = (uint8_t) ( mem->val & 0x00FF );
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }
                 else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = (inst == PUSH_INST) ? 0xFF : 0x8F;
-                        uint8_t byte3 = (inst == PUSH_INST) ? ((mem.mod << 6) | mem.rm) : ((mem.mod << 6) | 0b00110000 | mem.rm);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        printf("Mod: %d, Rm: %d, Reg: %d\n", mem.mod, mem.rm, reg.id);
+                        uint8_t byte3 = (inst == PUSH_INST) ? ((mem->mod << 6) | mem->rm) : ((mem->mod << 6) | 0b00110000 | mem->rm);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        printf("Mod: %d, Rm: %d, Reg: %d\n", mem->mod, mem->rm, reg->id);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
                         uint8_t byte1 = (inst == PUSH_INST) ? 0xFF : 0x8F;
-                        uint8_t byte2 = (inst == POP_INST) ? ((mem.mod << 6) | mem.rm) : ((mem.mod << 6) | 0b00110000 | mem.rm);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        printf("Mod: %d, Rm: %d, Reg: %d\n", mem.mod, mem.rm, reg.id);
+                        uint8_t byte2 = (inst == POP_INST) ? ((mem->mod << 6) | mem->rm) : ((mem->mod << 6) | 0b00110000 | mem->rm);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        printf("Mod: %d, Rm: %d, Reg: %d\n", mem->mod, mem->rm, reg->id);
                     }
                 }
             }else{
@@ -721,75 +705,76 @@ Boolean_t EncodeStackBlock(uint8_t mode, uint8_t inst, Register_t reg, uint8_t s
             break;
     }
 
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeXchg(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem)
+Boolean_t EncodeXchg(uint8_t mode, const Operand_t *op)
 {
+    const Operand_t *regd = &op[0], *regs = &op[1];
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_XCHG, mode, 0, op) == TRUE)
+        return TRUE;
     switch(mode){
         case MODE_REG_REG:
-            if( (regd.id == GPR_ALAX) && (regd.size == SZ_WORD) && (regs.size == SZ_WORD) ){
-                SegmentTable[stsize-1].LC += 1;
-                uint8_t byte1 = 0b10010000 | regd.id;
-                WriteByte2File(byte1);
-            }else if( (regd.size == SZ_BYTE) && (regs.size == SZ_BYTE) ){
-                SegmentTable[stsize-1].LC += 2;
+            if( (regd->id == GPR_ALAX) && (regd->size == SZ_WORD) && (regs->size == SZ_WORD) ){
+                uint8_t byte1 = 0b10010000 | regd->id;
+                INSN_PUT(insn, byte1);
+            }else if( (regd->size == SZ_BYTE) && (regs->size == SZ_BYTE) ){
                 uint8_t byte1 = 0x86;
-                uint8_t byte2 = 0b11000000 | (regd.id << 3) | regs.id;
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
-            }else if( (regd.size == SZ_WORD) && (regs.size == SZ_WORD) ){
-                SegmentTable[stsize-1].LC += 2;
+                uint8_t byte2 = 0b11000000 | (regd->id << 3) | regs->id;
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
+            }else if( (regd->size == SZ_WORD) && (regs->size == SZ_WORD) ){
                 uint8_t byte1 = 0x87;
-                uint8_t byte2 = 0b11000000 | (regd.id << 3) | regs.id;
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
+                uint8_t byte2 = 0b11000000 | (regd->id << 3) | regs->id;
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
             }
             break;
         case MODE_MEM_REG:
-            if( mem.size == regs.size ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ) {
+            if( mem->size == regs->size ){
+                if( mem->disps > 0 ) {
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
-                        uint8_t byte2 = (mem.size == SZ_BYTE) ? 0x86 : 0x87;
-                        uint8_t byte3 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte2 = (mem->size == SZ_BYTE) ? 0x86 : 0x87;
+                        uint8_t byte3 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
-                        uint8_t byte1 = (mem.size == SZ_BYTE) ? 0x86 : 0x87;
-                        uint8_t byte2 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte1 = (mem->size == SZ_BYTE) ? 0x86 : 0x87;
+                        uint8_t byte2 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
-                        uint8_t byte2 = (mem.size == SZ_BYTE) ? 0x86 : 0x87;
-                        uint8_t byte3 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte2 = (mem->size == SZ_BYTE) ? 0x86 : 0x87;
+                        uint8_t byte3 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
-                        uint8_t byte1 = (mem.size == SZ_BYTE) ? 0x86 : 0x87;
-                        uint8_t byte2 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte1 = (mem->size == SZ_BYTE) ? 0x86 : 0x87;
+                        uint8_t byte2 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -801,17 +786,22 @@ Boolean_t EncodeXchg(uint8_t mode, Register_t regd, Register_t regs, Memory_t me
             break;
     }
 
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeIOBlock(uint8_t mode, uint8_t inst, Register_t reg, Immediate_t imm)
+Boolean_t EncodeIOBlock(uint8_t mode, uint8_t inst, const Operand_t *op)
 {
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_IO, mode, inst, op) == TRUE)
+        return TRUE;
     switch(mode){
         case MODE_IMM:
-            if( imm.size == SZ_BYTE ){
-                SegmentTable[stsize-1].LC += 2;
+            if( imm->size == SZ_BYTE ){
                 uint8_t byte1;
-                uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
+                uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
                 switch(inst){
                     case INB_INST:
                         byte1 = 0xE4;
@@ -826,17 +816,16 @@ Boolean_t EncodeIOBlock(uint8_t mode, uint8_t inst, Register_t reg, Immediate_t
                         byte1 = 0xE7;
                         break;
                 }
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
+                INSN_PUT(insn, byte1);
+                INSN_IMM(insn, byte2);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
             }
             break;
         case MODE_REG:
-            if( reg.size == SZ_WORD ){
-                if( reg.id == GPR_DLDX ){
-                    SegmentTable[stsize-1].LC += 1;
+            if( reg->size == SZ_WORD ){
+                if( reg->id == GPR_DLDX ){
                     uint8_t byte1;
                     switch(inst){
                         case INB_INST:
@@ -852,7 +841,7 @@ Boolean_t EncodeIOBlock(uint8_t mode, uint8_t inst, Register_t reg, Immediate_t
                             byte1 = 0xEF;
                             break;
                     }
-                    WriteByte2File(byte1);
+                    INSN_PUT(insn, byte1);
                 }else{
                     PrintError(COLOR_BOLDRED, "Line %d :: Instruction-Operand mismatch!\n", LN);
                     return FALSE;
@@ -868,53 +857,57 @@ Boolean_t EncodeIOBlock(uint8_t mode, uint8_t inst, Register_t reg, Immediate_t
             break;
     }
 
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeAddressBlock(uint8_t inst, Register_t reg, Memory_t mem)
+Boolean_t EncodeAddressBlock(uint8_t inst, const Operand_t *op)
 {
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_ADDRESS, MODE_REG_MEM, inst, op) == TRUE)
+        return TRUE;
     switch(inst){
         case LEA_INST:
-            if( (reg.size == SZ_WORD) && (mem.size == SZ_WORD) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            if( (reg->size == SZ_WORD) && (mem->size == SZ_WORD) ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0x8D;
-                        uint8_t byte3 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = 0x8D;
-                        uint8_t byte2 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0x8D;
-                        uint8_t byte3 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte3 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
                         uint8_t byte1 = 0x8D;
-                        uint8_t byte2 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte2 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -923,46 +916,44 @@ Boolean_t EncodeAddressBlock(uint8_t inst, Register_t reg, Memory_t mem)
             }
             break;
         case LDS_INST:
-            if( (reg.size == SZ_WORD) && (mem.size == SZ_DWORD) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            if( (reg->size == SZ_WORD) && (mem->size == SZ_DWORD) ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xC5;
-                        uint8_t byte3 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = 0xC5;
-                        uint8_t byte2 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xC5;
-                        uint8_t byte3 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte3 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
                         uint8_t byte1 = 0xC5;
-                        uint8_t byte2 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte2 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -971,46 +962,44 @@ Boolean_t EncodeAddressBlock(uint8_t inst, Register_t reg, Memory_t mem)
             }
             break;
         case LES_INST:
-            if( (reg.size == SZ_WORD) && (mem.size == SZ_DWORD) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            if( (reg->size == SZ_WORD) && (mem->size == SZ_DWORD) ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xC4;
-                        uint8_t byte3 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = 0xC4;
-                        uint8_t byte2 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xC4;
-                        uint8_t byte3 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte3 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
                         uint8_t byte1 = 0xC4;
-                        uint8_t byte2 = (mem.mod << 6) | (reg.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte2 = (mem->mod << 6) | (reg->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -1026,196 +1015,200 @@ Boolean_t EncodeAddressBlock(uint8_t inst, Register_t reg, Memory_t mem)
     if(isSOP == SET)
         isSOP = NSET;
 
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm)
+Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, const Operand_t *op)
 {
+    const Operand_t *regd = &op[0], *regs = &op[1];
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_ARITH, mode, inst, op) == TRUE)
+        return TRUE;
     Boolean_t sgx;
     switch(mode){
         case MODE_REG_REG:
-            if(regd.size == regs.size){
-                SegmentTable[stsize-1].LC += 2;
+            if(regd->size == regs->size){
                 uint8_t byte1;
                 switch(inst){
                     case ADC_INST:
-                        byte1 = (regd.size == SZ_BYTE) ? 0x10 : 0x11 ;
+                        byte1 = (regd->size == SZ_BYTE) ? 0x10 : 0x11 ;
                         break;
                     case ADD_INST:
-                        byte1 = (regd.size == SZ_BYTE) ? 0x00 : 0x01 ;
+                        byte1 = (regd->size == SZ_BYTE) ? 0x00 : 0x01 ;
                         break;
                     case AND_INST:
-                        byte1 = (regd.size == SZ_BYTE) ? 0x20 : 0x21 ;
+                        byte1 = (regd->size == SZ_BYTE) ? 0x20 : 0x21 ;
                         break;
                     case CMP_INST:
-                        byte1 = (regd.size == SZ_BYTE) ? 0x38 : 0x39 ;
+                        byte1 = (regd->size == SZ_BYTE) ? 0x38 : 0x39 ;
                         break;
                     case OR_INST:
-                        byte1 = (regd.size == SZ_BYTE) ? 0x08 : 0x09 ;
+                        byte1 = (regd->size == SZ_BYTE) ? 0x08 : 0x09 ;
                         break;
                     case SBB_INST:
-                        byte1 = (regd.size == SZ_BYTE) ? 0x18 : 0x19 ;
+                        byte1 = (regd->size == SZ_BYTE) ? 0x18 : 0x19 ;
                         break;
                     case SUB_INST:
-                        byte1 = (regd.size == SZ_BYTE) ? 0x28 : 0x29 ;
+                        byte1 = (regd->size == SZ_BYTE) ? 0x28 : 0x29 ;
                         break;
                     case XOR_INST:
-                        byte1 = (regd.size == SZ_BYTE) ? 0x30 : 0x31 ;
+                        byte1 = (regd->size == SZ_BYTE) ? 0x30 : 0x31 ;
                         break;
                 }
-                uint8_t byte2 = 0b11000000 | (regs.id << 3) | regd.id;
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
+                uint8_t byte2 = 0b11000000 | (regs->id << 3) | regd->id;
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
             }
             break;
         case MODE_REG_MEM:
-            if(regd.size == mem.size){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            if(regd->size == mem->size){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2;
                         switch(inst){
                             case ADC_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x12 : 0x13 ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x12 : 0x13 ;
                                 break;
                             case ADD_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x02 : 0x03 ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x02 : 0x03 ;
                                 break;
                             case AND_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x22 : 0x23 ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x22 : 0x23 ;
                                 break;
                             case CMP_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x3A : 0x3B ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x3A : 0x3B ;
                                 break;
                             case OR_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x0A : 0x0B ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x0A : 0x0B ;
                                 break;
                             case SBB_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x1A : 0x1B ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x1A : 0x1B ;
                                 break;
                             case SUB_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x2A : 0x2B ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x2A : 0x2B ;
                                 break;
                             case XOR_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x32 : 0x33 ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x32 : 0x33 ;
                                 break;
                         }
-                        uint8_t byte3 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1;
                         switch(inst){
                             case ADC_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x12 : 0x13 ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x12 : 0x13 ;
                                 break;
                             case ADD_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x02 : 0x03 ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x02 : 0x03 ;
                                 break;
                             case AND_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x22 : 0x23 ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x22 : 0x23 ;
                                 break;
                             case CMP_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x3A : 0x3B ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x3A : 0x3B ;
                                 break;
                             case OR_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x0A : 0x0B ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x0A : 0x0B ;
                                 break;
                             case SBB_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x1A : 0x1B ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x1A : 0x1B ;
                                 break;
                             case SUB_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x2A : 0x2B ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x2A : 0x2B ;
                                 break;
                             case XOR_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x32 : 0x33 ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x32 : 0x33 ;
                                 break;
                         }
-                        uint8_t byte2 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
                         uint8_t byte2;
                         switch(inst){
                             case ADC_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x12 : 0x13 ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x12 : 0x13 ;
                                 break;
                             case ADD_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x02 : 0x03 ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x02 : 0x03 ;
                                 break;
                             case AND_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x22 : 0x23 ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x22 : 0x23 ;
                                 break;
                             case CMP_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x3A : 0x3B ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x3A : 0x3B ;
                                 break;
                             case OR_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x0A : 0x0B ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x0A : 0x0B ;
                                 break;
                             case SBB_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x1A : 0x1B ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x1A : 0x1B ;
                                 break;
                             case SUB_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x2A : 0x2B ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x2A : 0x2B ;
                                 break;
                             case XOR_INST:
-                                byte2 = (regd.size == SZ_BYTE) ? 0x32 : 0x33 ;
+                                byte2 = (regd->size == SZ_BYTE) ? 0x32 : 0x33 ;
                                 break;
                         }
-                        uint8_t byte3 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte3 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
                         uint8_t byte1;
                         switch(inst){
                             case ADC_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x12 : 0x13 ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x12 : 0x13 ;
                                 break;
                             case ADD_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x02 : 0x03 ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x02 : 0x03 ;
                                 break;
                             case AND_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x22 : 0x23 ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x22 : 0x23 ;
                                 break;
                             case CMP_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x3A : 0x3B ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x3A : 0x3B ;
                                 break;
                             case OR_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x0A : 0x0B ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x0A : 0x0B ;
                                 break;
                             case SBB_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x1A : 0x1B ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x1A : 0x1B ;
                                 break;
                             case SUB_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x2A : 0x2B ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x2A : 0x2B ;
                                 break;
                             case XOR_INST:
-                                byte1 = (regd.size == SZ_BYTE) ? 0x32 : 0x33 ;
+                                byte1 = (regd->size == SZ_BYTE) ? 0x32 : 0x33 ;
                                 break;
                         }
-                        uint8_t byte2 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte2 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -1226,150 +1219,148 @@ Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, Register_t regd, Reg
                 isSOP = NSET;
             break;
         case MODE_MEM_REG:
-            if(regs.size == mem.size){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            if(regs->size == mem->size){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2;
                         switch(inst){
                             case ADC_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x10 : 0x11 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x10 : 0x11 ;
                                 break;
                             case ADD_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x00 : 0x01 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x00 : 0x01 ;
                                 break;
                             case AND_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x20 : 0x21 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x20 : 0x21 ;
                                 break;
                             case CMP_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x38 : 0x39 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x38 : 0x39 ;
                                 break;
                             case OR_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x08 : 0x09 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x08 : 0x09 ;
                                 break;
                             case SBB_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x18 : 0x19 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x18 : 0x19 ;
                                 break;
                             case SUB_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x28 : 0x29 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x28 : 0x29 ;
                                 break;
                             case XOR_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x30 : 0x31 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x30 : 0x31 ;
                                 break;
                         }
-                        uint8_t byte3 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1;
                         switch(inst){
                             case ADC_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x10 : 0x11 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x10 : 0x11 ;
                                 break;
                             case ADD_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x00 : 0x01 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x00 : 0x01 ;
                                 break;
                             case AND_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x20 : 0x21 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x20 : 0x21 ;
                                 break;
                             case CMP_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x38 : 0x39 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x38 : 0x39 ;
                                 break;
                             case OR_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x08 : 0x09 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x08 : 0x09 ;
                                 break;
                             case SBB_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x18 : 0x19 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x18 : 0x19 ;
                                 break;
                             case SUB_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x28 : 0x29 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x28 : 0x29 ;
                                 break;
                             case XOR_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x30 : 0x31 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x30 : 0x31 ;
                                 break;
                         }
-                        uint8_t byte2 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
                         uint8_t byte2;
                         switch(inst){
                             case ADC_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x10 : 0x11 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x10 : 0x11 ;
                                 break;
                             case ADD_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x00 : 0x01 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x00 : 0x01 ;
                                 break;
                             case AND_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x20 : 0x21 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x20 : 0x21 ;
                                 break;
                             case CMP_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x38 : 0x39 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x38 : 0x39 ;
                                 break;
                             case OR_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x08 : 0x09 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x08 : 0x09 ;
                                 break;
                             case SBB_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x18 : 0x19 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x18 : 0x19 ;
                                 break;
                             case SUB_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x28 : 0x29 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x28 : 0x29 ;
                                 break;
                             case XOR_INST:
-                                byte2 = (regs.size == SZ_BYTE) ? 0x30 : 0x31 ;
+                                byte2 = (regs->size == SZ_BYTE) ? 0x30 : 0x31 ;
                                 break;
                         }
-                        uint8_t byte3 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte3 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
                         uint8_t byte1;
                         switch(inst){
                             case ADC_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x10 : 0x11 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x10 : 0x11 ;
                                 break;
                             case ADD_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x00 : 0x01 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x00 : 0x01 ;
                                 break;
                             case AND_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x20 : 0x21 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x20 : 0x21 ;
                                 break;
                             case CMP_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x38 : 0x39 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x38 : 0x39 ;
                                 break;
                             case OR_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x08 : 0x09 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x08 : 0x09 ;
                                 break;
                             case SBB_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x18 : 0x19 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x18 : 0x19 ;
                                 break;
                             case SUB_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x28 : 0x29 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x28 : 0x29 ;
                                 break;
                             case XOR_INST:
-                                byte1 = (regs.size == SZ_BYTE) ? 0x30 : 0x31 ;
+                                byte1 = (regs->size == SZ_BYTE) ? 0x30 : 0x31 ;
                                 break;
                         }
-                        uint8_t byte2 = (mem.mod << 6) | (regs.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte2 = (mem->mod << 6) | (regs->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -1381,10 +1372,10 @@ Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, Register_t regd, Reg
                 isSOP = NSET;
             break;
         case MODE_REG_IMM:
-            sgx = CheckSignExtension(imm.val);
-            if( (regd.size == SZ_BYTE) && (imm.size == SZ_BYTE) ){
-                if(regd.id == GPR_ALAX){
-                    SegmentTable[stsize-1].LC += 2;     // Acc8, imm8
+            sgx = CheckSignExtension(imm->val);
+            if( (regd->size == SZ_BYTE) && (imm->size == SZ_BYTE) ){
+                if(regd->id == GPR_ALAX){
+                    // Acc8, imm8
                     uint8_t byte1;
                     switch(inst){
                         case ADC_INST:
@@ -1412,47 +1403,47 @@ Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, Register_t regd, Reg
                             byte1 = 0x34;
                             break;
                     }
-                    uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
+                    uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
+                    INSN_PUT(insn, byte1);
+                    INSN_IMM(insn, byte2);
                 }else{
-                    SegmentTable[stsize-1].LC += 3;     // Reg8, Imm8
+                    // Reg8, Imm8
                     uint8_t byte1 = 0x80;
                     uint8_t byte2;
                     switch(inst){
                         case ADC_INST:
-                            byte2 = 0b11000000 | 0b00010000 | regd.id;
+                            byte2 = 0b11000000 | 0b00010000 | regd->id;
                             break;
                         case ADD_INST:
-                            byte2 = 0b11000000 | 0b00000000 | regd.id;
+                            byte2 = 0b11000000 | 0b00000000 | regd->id;
                             break;
                         case AND_INST:
-                            byte2 = 0b11000000 | 0b00100000 | regd.id;
+                            byte2 = 0b11000000 | 0b00100000 | regd->id;
                             break;
                         case CMP_INST:
-                            byte2 = 0b11000000 | 0b00111000 | regd.id;
+                            byte2 = 0b11000000 | 0b00111000 | regd->id;
                             break;
                         case OR_INST:
-                            byte2 = 0b11000000 | 0b00001000 | regd.id;
+                            byte2 = 0b11000000 | 0b00001000 | regd->id;
                             break;
                         case SBB_INST:
-                            byte2 = 0b11000000 | 0b00011000 | regd.id;
+                            byte2 = 0b11000000 | 0b00011000 | regd->id;
                             break;
                         case SUB_INST:
-                            byte2 = 0b11000000 | 0b00101000 | regd.id;
+                            byte2 = 0b11000000 | 0b00101000 | regd->id;
                             break;
                         case XOR_INST:
-                            byte2 = 0b11000000 | 0b00110000 | regd.id;
+                            byte2 = 0b11000000 | 0b00110000 | regd->id;
                             break;
                     }
-                    uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
+                    uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                    INSN_PUT(insn, byte1);
+                    INSN_PUT(insn, byte2);
+                    INSN_IMM(insn, byte3);
                 }
-            }else if( (regd.size == SZ_WORD) && (imm.size == SZ_BYTE) ){
-                if( (regd.id == GPR_ALAX) && (sgx == FALSE) ){
-                    SegmentTable[stsize-1].LC += 3;    // Acc16, imm8
+            }else if( (regd->size == SZ_WORD) && (imm->size == SZ_BYTE) ){
+                if( (regd->id == GPR_ALAX) && (sgx == FALSE) ){
+                    // Acc16, imm8
                     uint8_t byte1;
                     switch(inst){
                         case ADC_INST:
@@ -1480,85 +1471,85 @@ Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, Register_t regd, Reg
                             byte1 = 0x35;
                             break;
                     }
-                    uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
-                    uint8_t byte3 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
-                }else if( (regd.id != GPR_ALAX) && (sgx == FALSE) ){
-                    SegmentTable[stsize-1].LC += 4;    // Reg16, imm8
+                    uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
+                    uint8_t byte3 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                    INSN_PUT(insn, byte1);
+                    INSN_IMM(insn, byte2);
+                    INSN_PUT(insn, byte3);
+                }else if( (regd->id != GPR_ALAX) && (sgx == FALSE) ){
+                    // Reg16, imm8
                     uint8_t byte1 = 0x81;
                     uint8_t byte2;
                     switch(inst){
                         case ADC_INST:
-                            byte2 = 0b11000000 | 0b00010000 | regd.id;
+                            byte2 = 0b11000000 | 0b00010000 | regd->id;
                             break;
                         case ADD_INST:
-                            byte2 = 0b11000000 | 0b00000000 | regd.id;
+                            byte2 = 0b11000000 | 0b00000000 | regd->id;
                             break;
                         case AND_INST:
-                            byte2 = 0b11000000 | 0b00100000 | regd.id;
+                            byte2 = 0b11000000 | 0b00100000 | regd->id;
                             break;
                         case CMP_INST:
-                            byte2 = 0b11000000 | 0b00111000 | regd.id;
+                            byte2 = 0b11000000 | 0b00111000 | regd->id;
                             break;
                         case OR_INST:
-                            byte2 = 0b11000000 | 0b00001000 | regd.id;
+                            byte2 = 0b11000000 | 0b00001000 | regd->id;
                             break;
                         case SBB_INST:
-                            byte2 = 0b11000000 | 0b00011000 | regd.id;
+                            byte2 = 0b11000000 | 0b00011000 | regd->id;
                             break;
                         case SUB_INST:
-                            byte2 = 0b11000000 | 0b00101000 | regd.id;
+                            byte2 = 0b11000000 | 0b00101000 | regd->id;
                             break;
                         case XOR_INST:
-                            byte2 = 0b11000000 | 0b00110000 | regd.id;
+                            byte2 = 0b11000000 | 0b00110000 | regd->id;
                             break;
                     }
-                    uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
+                    uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
                     uint8_t byte4 = 0;
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
-                    WriteByte2File(byte4);
+                    INSN_PUT(insn, byte1);
+                    INSN_PUT(insn, byte2);
+                    INSN_IMM(insn, byte3);
+                    INSN_PUT(insn, byte4);
                 }else{
-                    SegmentTable[stsize-1].LC += 3;    // Reg16, imm8_sgx
+                    // Reg16, imm8_sgx
                     uint8_t byte1 = 0x83;
                     uint8_t byte2;
                     switch(inst){
                         case ADC_INST:
-                            byte2 = 0b11000000 | 0b00010000 | regd.id;
+                            byte2 = 0b11000000 | 0b00010000 | regd->id;
                             break;
                         case ADD_INST:
-                            byte2 = 0b11000000 | 0b00000000 | regd.id;
+                            byte2 = 0b11000000 | 0b00000000 | regd->id;
                             break;
                         case AND_INST:
-                            byte2 = 0b11000000 | 0b00100000 | regd.id;
+                            byte2 = 0b11000000 | 0b00100000 | regd->id;
                             break;
                         case CMP_INST:
-                            byte2 = 0b11000000 | 0b00111000 | regd.id;
+                            byte2 = 0b11000000 | 0b00111000 | regd->id;
                             break;
                         case OR_INST:
-                            byte2 = 0b11000000 | 0b00001000 | regd.id;
+                            byte2 = 0b11000000 | 0b00001000 | regd->id;
                             break;
                         case SBB_INST:
-                            byte2 = 0b11000000 | 0b00011000 | regd.id;
+                            byte2 = 0b11000000 | 0b00011000 | regd->id;
                             break;
                         case SUB_INST:
-                            byte2 = 0b11000000 | 0b00101000 | regd.id;
+                            byte2 = 0b11000000 | 0b00101000 | regd->id;
                             break;
                         case XOR_INST:
-                            byte2 = 0b11000000 | 0b00110000 | regd.id;
+                            byte2 = 0b11000000 | 0b00110000 | regd->id;
                             break;
                     }
-                    uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
+                    uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                    INSN_PUT(insn, byte1);
+                    INSN_PUT(insn, byte2);
+                    INSN_IMM(insn, byte3);
                 }
-            }else if( (regd.size == SZ_WORD) && (imm.size == SZ_WORD) ){
-                if( (regd.id == GPR_ALAX) && (sgx == FALSE) ){
-                    SegmentTable[stsize-1].LC += 3;    // Acc16, imm16
+            }else if( (regd->size == SZ_WORD) && (imm->size == SZ_WORD) ){
+                if( (regd->id == GPR_ALAX) && (sgx == FALSE) ){
+                    // Acc16, imm16
                     uint8_t byte1;
                     switch(inst){
                         case ADC_INST:
@@ -1586,81 +1577,81 @@ Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, Register_t regd, Reg
                             byte1 = 0x35;
                             break;
                     }
-                    uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
-                    uint8_t byte3 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
-                }else if( (regd.id != GPR_ALAX) && (sgx == FALSE) ){
-                    SegmentTable[stsize-1].LC += 4;    // Reg16, imm16
+                    uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
+                    uint8_t byte3 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                    INSN_PUT(insn, byte1);
+                    INSN_IMM(insn, byte2);
+                    INSN_PUT(insn, byte3);
+                }else if( (regd->id != GPR_ALAX) && (sgx == FALSE) ){
+                    // Reg16, imm16
                     uint8_t byte1 = 0x81;
                     uint8_t byte2;
                     switch(inst){
                         case ADC_INST:
-                            byte2 = 0b11000000 | 0b00010000 | regd.id;
+                            byte2 = 0b11000000 | 0b00010000 | regd->id;
                             break;
                         case ADD_INST:
-                            byte2 = 0b11000000 | 0b00000000 | regd.id;
+                            byte2 = 0b11000000 | 0b00000000 | regd->id;
                             break;
                         case AND_INST:
-                            byte2 = 0b11000000 | 0b00100000 | regd.id;
+                            byte2 = 0b11000000 | 0b00100000 | regd->id;
                             break;
                         case CMP_INST:
-                            byte2 = 0b11000000 | 0b00111000 | regd.id;
+                            byte2 = 0b11000000 | 0b00111000 | regd->id;
                             break;
                         case OR_INST:
-                            byte2 = 0b11000000 | 0b00001000 | regd.id;
+                            byte2 = 0b11000000 | 0b00001000 | regd->id;
                             break;
                         case SBB_INST:
-                            byte2 = 0b11000000 | 0b00011000 | regd.id;
+                            byte2 = 0b11000000 | 0b00011000 | regd->id;
                             break;
                         case SUB_INST:
-                            byte2 = 0b11000000 | 0b00101000 | regd.id;
+                            byte2 = 0b11000000 | 0b00101000 | regd->id;
                             break;
                         case XOR_INST:
-                            byte2 = 0b11000000 | 0b00110000 | regd.id;
+                            byte2 = 0b11000000 | 0b00110000 | regd->id;
                             break;
                     }
-                    uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                    uint8_t byte4 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
-                    WriteByte2File(byte4);
+                    uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                    uint8_t byte4 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                    INSN_PUT(insn, byte1);
+                    INSN_PUT(insn, byte2);
+                    INSN_IMM(insn, byte3);
+                    INSN_PUT(insn, byte4);
                 }else{
-                    SegmentTable[stsize-1].LC += 3;    // Reg16, imm16_sgx
+                    // Reg16, imm16_sgx
                     uint8_t byte1 = 0x83;
                     uint8_t byte2;
                     switch(inst){
                         case ADC_INST:
-                            byte2 = 0b11000000 | 0b00010000 | regd.id;
+                            byte2 = 0b11000000 | 0b00010000 | regd->id;
                             break;
                         case ADD_INST:
-                            byte2 = 0b11000000 | 0b00000000 | regd.id;
+                            byte2 = 0b11000000 | 0b00000000 | regd->id;
                             break;
                         case AND_INST:
-                            byte2 = 0b11000000 | 0b00100000 | regd.id;
+                            byte2 = 0b11000000 | 0b00100000 | regd->id;
                             break;
                         case CMP_INST:
-                            byte2 = 0b11000000 | 0b00111000 | regd.id;
+                            byte2 = 0b11000000 | 0b00111000 | regd->id;
                             break;
                         case OR_INST:
-                            byte2 = 0b11000000 | 0b00001000 | regd.id;
+                            byte2 = 0b11000000 | 0b00001000 | regd->id;
                             break;
                         case SBB_INST:
-                            byte2 = 0b11000000 | 0b00011000 | regd.id;
+                            byte2 = 0b11000000 | 0b00011000 | regd->id;
                             break;
                         case SUB_INST:
-                            byte2 = 0b11000000 | 0b00101000 | regd.id;
+                            byte2 = 0b11000000 | 0b00101000 | regd->id;
                             break;
                         case XOR_INST:
-                            byte2 = 0b11000000 | 0b00110000 | regd.id;
+                            byte2 = 0b11000000 | 0b00110000 | regd->id;
                             break;
                     }
-                    uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
+                    uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                    INSN_PUT(insn, byte1);
+                    INSN_PUT(insn, byte2);
+                    INSN_IMM(insn, byte3);
                 }
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -1668,794 +1659,784 @@ Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, Register_t regd, Reg
             }
             break;
         case MODE_MEM_IMM:
-            sgx = CheckSignExtension(imm.val);
-            if( (mem.size == SZ_BYTE) && (imm.size == SZ_BYTE) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            sgx = CheckSignExtension(imm->val);
+            if( (mem->size == SZ_BYTE) && (imm->size == SZ_BYTE) ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 6;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0x80;
                         uint8_t byte3;
                         switch(inst){
                             case ADC_INST:
-                                byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                             case ADD_INST:
-                                byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                 break;
                             case AND_INST:
-                                byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case CMP_INST:
-                                byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case OR_INST:
-                                byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                 break;
                             case SBB_INST:
-                                byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case SUB_INST:
-                                byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                             case XOR_INST:
-                                byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                 break;
                         }
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        uint8_t byte6 = (uint8_t) (imm.val & 0x00FF);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
-                        WriteByte2File(byte6);
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        uint8_t byte6 = (uint8_t) (imm->val & 0x00FF);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
+                        INSN_IMM(insn, byte6);
                     }else{
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = 0x80;
                         uint8_t byte2;
                         switch(inst){
                             case ADC_INST:
-                                byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                             case ADD_INST:
-                                byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                 break;
                             case AND_INST:
-                                byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case CMP_INST:
-                                byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case OR_INST:
-                                byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                 break;
                             case SBB_INST:
-                                byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case SUB_INST:
-                                byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                             case XOR_INST:
-                                byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                 break;
                         }
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        uint8_t byte5 = (uint8_t) (imm.val & 0x00FF);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        uint8_t byte5 = (uint8_t) (imm->val & 0x00FF);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
+                        INSN_IMM(insn, byte5);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0x80;
                         uint8_t byte3;
                         switch(inst){
                             case ADC_INST:
-                                byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                             case ADD_INST:
-                                byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                 break;
                             case AND_INST:
-                                byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case CMP_INST:
-                                byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case OR_INST:
-                                byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                 break;
                             case SBB_INST:
-                                byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case SUB_INST:
-                                byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                             case XOR_INST:
-                                byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                 break;
                         }
-                        uint8_t byte4 = (uint8_t) (imm.val & 0x00FF);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte4 = (uint8_t) (imm->val & 0x00FF);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_IMM(insn, byte4);
                     }else{
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = 0x80;
                         uint8_t byte2;
                         switch(inst){
                             case ADC_INST:
-                                byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                             case ADD_INST:
-                                byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                 break;
                             case AND_INST:
-                                byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case CMP_INST:
-                                byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case OR_INST:
-                                byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                 break;
                             case SBB_INST:
-                                byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case SUB_INST:
-                                byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                             case XOR_INST:
-                                byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                 break;
                         }
-                        uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_IMM(insn, byte3);
                     }
                 }
-            }else if( (mem.size == SZ_WORD) && (imm.size == SZ_BYTE) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            }else if( (mem->size == SZ_WORD) && (imm->size == SZ_BYTE) ){
+                if( mem->disps > 0 ){
                     if(sgx == TRUE){
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 6;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x83;
                             uint8_t byte3;
                             switch(inst){
                                 case ADC_INST:
-                                    byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            uint8_t byte6 = (uint8_t) (imm.val & 0x00FF);
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
-                            WriteByte2File(byte6);
+                            uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            uint8_t byte6 = (uint8_t) (imm->val & 0x00FF);
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_DISP(insn, byte4);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte5);
+                            INSN_IMM(insn, byte6);
                         }else{
-                            SegmentTable[stsize-1].LC += 5;
                             uint8_t byte1 = 0x83;
                             uint8_t byte2;
                             switch(inst){
                                 case ADC_INST:
-                                    byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            uint8_t byte5 = (uint8_t) (imm.val & 0x00FF);
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
+                            uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            uint8_t byte5 = (uint8_t) (imm->val & 0x00FF);
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_DISP(insn, byte3);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte4);
+                            INSN_IMM(insn, byte5);
                         }
                     }else{
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 7;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x81;
                             uint8_t byte3;
                             switch(inst){
                                 case ADC_INST:
-                                    byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            uint8_t byte6 = (uint8_t) (imm.val & 0x00FF);
-                            uint8_t byte7 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
-                            WriteByte2File(byte6);
-                            WriteByte2File(byte7);
+                            uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            uint8_t byte6 = (uint8_t) (imm->val & 0x00FF);
+                            uint8_t byte7 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_DISP(insn, byte4);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte5);
+                            INSN_IMM(insn, byte6);
+                            INSN_PUT(insn, byte7);
                         }else{
-                            SegmentTable[stsize-1].LC += 6;
                             uint8_t byte1 = 0x81;
                             uint8_t byte2;
                             switch(inst){
                                 case ADC_INST:
-                                    byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            uint8_t byte5 = (uint8_t) (imm.val & 0x00FF);
-                            uint8_t byte6 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
-                            WriteByte2File(byte6);
+                            uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            uint8_t byte5 = (uint8_t) (imm->val & 0x00FF);
+                            uint8_t byte6 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_DISP(insn, byte3);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte4);
+                            INSN_IMM(insn, byte5);
+                            INSN_PUT(insn, byte6);
                         }
                     }
                 }else{
                     if(sgx == TRUE){
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 4;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x83;
                             uint8_t byte3;
                             switch(inst){
                                 case ADC_INST:
-                                    byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte4 = (uint8_t) (imm.val & 0x00FF);
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
+                            uint8_t byte4 = (uint8_t) (imm->val & 0x00FF);
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_IMM(insn, byte4);
                         }else{
-                            SegmentTable[stsize-1].LC += 3;
                             uint8_t byte1 = 0x83;
                             uint8_t byte2;
                             switch(inst){
                                 case ADC_INST:
-                                    byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
+                            uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_IMM(insn, byte3);
                         }
                     }else{
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 5;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x81;
                             uint8_t byte3;
                             switch(inst){
                                 case ADC_INST:
-                                    byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte4 = (uint8_t) (imm.val & 0x00FF);
-                            uint8_t byte5 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
+                            uint8_t byte4 = (uint8_t) (imm->val & 0x00FF);
+                            uint8_t byte5 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_IMM(insn, byte4);
+                            INSN_PUT(insn, byte5);
                         }else{
-                            SegmentTable[stsize-1].LC += 4;
                             uint8_t byte1 = 0x81;
                             uint8_t byte2;
                             switch(inst){
                                 case ADC_INST:
-                                    byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                            uint8_t byte4 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
+                            uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                            uint8_t byte4 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_IMM(insn, byte3);
+                            INSN_PUT(insn, byte4);
                         }
                     }
                 }
-            }else if( (mem.size == SZ_WORD) && (imm.size == SZ_WORD) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            }else if( (mem->size == SZ_WORD) && (imm->size == SZ_WORD) ){
+                if( mem->disps > 0 ){
                     if(sgx == TRUE){
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 6;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x83;
                             uint8_t byte3;
                             switch(inst){
                                 case ADC_INST:
-                                    byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            uint8_t byte6 = (uint8_t) (imm.val & 0x00FF);
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
-                            WriteByte2File(byte6);
+                            uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            uint8_t byte6 = (uint8_t) (imm->val & 0x00FF);
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_DISP(insn, byte4);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte5);
+                            INSN_IMM(insn, byte6);
                         }else{
-                            SegmentTable[stsize-1].LC += 5;
                             uint8_t byte1 = 0x83;
                             uint8_t byte2;
                             switch(inst){
                                 case ADC_INST:
-                                    byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            uint8_t byte5 = (uint8_t) (imm.val & 0x00FF);
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
+                            uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            uint8_t byte5 = (uint8_t) (imm->val & 0x00FF);
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_DISP(insn, byte3);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte4);
+                            INSN_IMM(insn, byte5);
                         }
                     }else{
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 7;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x81;
                             uint8_t byte3;
                             switch(inst){
                                 case ADC_INST:
-                                    byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            uint8_t byte6 = (uint8_t) (imm.val & 0x00FF);
-                            uint8_t byte7 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
-                            WriteByte2File(byte6);
-                            WriteByte2File(byte7);
+                            uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            uint8_t byte6 = (uint8_t) (imm->val & 0x00FF);
+                            uint8_t byte7 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_DISP(insn, byte4);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte5);
+                            INSN_IMM(insn, byte6);
+                            INSN_PUT(insn, byte7);
                         }else{
-                            SegmentTable[stsize-1].LC += 6;
                             uint8_t byte1 = 0x81;
                             uint8_t byte2;
                             switch(inst){
                                 case ADC_INST:
-                                    byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            uint8_t byte5 = (uint8_t) (imm.val & 0x00FF);
-                            uint8_t byte6 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
-                            WriteByte2File(byte6);
+                            uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            uint8_t byte5 = (uint8_t) (imm->val & 0x00FF);
+                            uint8_t byte6 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_DISP(insn, byte3);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte4);
+                            INSN_IMM(insn, byte5);
+                            INSN_PUT(insn, byte6);
                         }
                     }
                 }else{
                     if(sgx == TRUE){
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 4;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x83;
                             uint8_t byte3;
                             switch(inst){
                                 case ADC_INST:
-                                    byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte4 = (uint8_t) (imm.val & 0x00FF);
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
+                            uint8_t byte4 = (uint8_t) (imm->val & 0x00FF);
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_IMM(insn, byte4);
                         }else{
-                            SegmentTable[stsize-1].LC += 3;
                             uint8_t byte1 = 0x83;
                             uint8_t byte2;
                             switch(inst){
                                 case ADC_INST:
-                                    byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
+                            uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_IMM(insn, byte3);
                         }
                     }else{
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 5;
                             uint8_t byte1 = SOP;
                             uint8_t byte2 = 0x81;
                             uint8_t byte3;
                             switch(inst){
                                 case ADC_INST:
-                                    byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte4 = (uint8_t) (imm.val & 0x00FF);
-                            uint8_t byte5 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
+                            uint8_t byte4 = (uint8_t) (imm->val & 0x00FF);
+                            uint8_t byte5 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_IMM(insn, byte4);
+                            INSN_PUT(insn, byte5);
                         }else{
-                            SegmentTable[stsize-1].LC += 4;
                             uint8_t byte1 = 0x81;
                             uint8_t byte2;
                             switch(inst){
                                 case ADC_INST:
-                                    byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case ADD_INST:
-                                    byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case AND_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case CMP_INST:
-                                    byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case OR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SBB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case SUB_INST:
-                                    byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                                 case XOR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                            uint8_t byte4 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
+                            uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                            uint8_t byte4 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_IMM(insn, byte3);
+                            INSN_PUT(insn, byte4);
                         }
                     }
                 }
@@ -2472,84 +2453,88 @@ Boolean_t EncodeArithmeticBlock(uint8_t mode, uint8_t inst, Register_t regd, Reg
             break;
     }
 
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeShiftRotateBlock(uint8_t mode, uint8_t inst, Register_t regd, Register_t regs, Memory_t mem)
+Boolean_t EncodeShiftRotateBlock(uint8_t mode, uint8_t inst, const Operand_t *op)
 {
+    const Operand_t *regd = &op[0], *regs = &op[1];
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_SHIFT, mode, inst, op) == TRUE)
+        return TRUE;
     switch(mode){
         case MODE_REG:
-            if( (regd.size == SZ_BYTE) || (regd.size == SZ_WORD) ){
-                SegmentTable[stsize-1].LC += 2;
-                uint8_t byte1 = (regd.size == SZ_BYTE) ? 0xD0 : 0xD1;
+            if( (regd->size == SZ_BYTE) || (regd->size == SZ_WORD) ){
+                uint8_t byte1 = (regd->size == SZ_BYTE) ? 0xD0 : 0xD1;
                 uint8_t byte2;
                 switch(inst){
                     case RCL_INST:
-                        byte2 = 0b11000000 | 0b00010000 | regd.id;
+                        byte2 = 0b11000000 | 0b00010000 | regd->id;
                         break;
                     case RCR_INST:
-                        byte2 = 0b11000000 | 0b00011000 | regd.id;
+                        byte2 = 0b11000000 | 0b00011000 | regd->id;
                         break;
                     case ROL_INST:
-                        byte2 = 0b11000000 | 0b00000000 | regd.id;
+                        byte2 = 0b11000000 | 0b00000000 | regd->id;
                         break;
                     case ROR_INST:
-                        byte2 = 0b11000000 | 0b00001000 | regd.id;
+                        byte2 = 0b11000000 | 0b00001000 | regd->id;
                         break;
                     case SAL_INST:
-                        byte2 = 0b11000000 | 0b00100000 | regd.id;
+                        byte2 = 0b11000000 | 0b00100000 | regd->id;
                         break;
                     case SAR_INST:
-                        byte2 = 0b11000000 | 0b00111000 | regd.id;
+                        byte2 = 0b11000000 | 0b00111000 | regd->id;
                         break;
                     case SHL_INST:
-                        byte2 = 0b11000000 | 0b00100000 | regd.id;
+                        byte2 = 0b11000000 | 0b00100000 | regd->id;
                         break;
                     case SHR_INST:
-                        byte2 = 0b11000000 | 0b00101000 | regd.id;
+                        byte2 = 0b11000000 | 0b00101000 | regd->id;
                         break;
                 }
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
             }
             break;
         case MODE_REG_REG:
-            if( (regd.size == SZ_BYTE) || (regd.size == SZ_WORD) ){
-                if( (regs.id == GPR_CLCX) && (regs.size == SZ_BYTE) ){
-                    SegmentTable[stsize-1].LC += 2;
-                    uint8_t byte1 = (regd.size == SZ_BYTE) ? 0xD2 : 0xD3;
+            if( (regd->size == SZ_BYTE) || (regd->size == SZ_WORD) ){
+                if( (regs->id == GPR_CLCX) && (regs->size == SZ_BYTE) ){
+                    uint8_t byte1 = (regd->size == SZ_BYTE) ? 0xD2 : 0xD3;
                     uint8_t byte2;
                     switch(inst){
                         case RCL_INST:
-                            byte2 = 0b11000000 | 0b00010000 | regd.id;
+                            byte2 = 0b11000000 | 0b00010000 | regd->id;
                             break;
                         case RCR_INST:
-                            byte2 = 0b11000000 | 0b00011000 | regd.id;
+                            byte2 = 0b11000000 | 0b00011000 | regd->id;
                             break;
                         case ROL_INST:
-                            byte2 = 0b11000000 | 0b00000000 | regd.id;
+                            byte2 = 0b11000000 | 0b00000000 | regd->id;
                             break;
                         case ROR_INST:
-                            byte2 = 0b11000000 | 0b00001000 | regd.id;
+                            byte2 = 0b11000000 | 0b00001000 | regd->id;
                             break;
                         case SAL_INST:
-                            byte2 = 0b11000000 | 0b00100000 | regd.id;
+                            byte2 = 0b11000000 | 0b00100000 | regd->id;
                             break;
                         case SAR_INST:
-                            byte2 = 0b11000000 | 0b00111000 | regd.id;
+                            byte2 = 0b11000000 | 0b00111000 | regd->id;
                             break;
                         case SHL_INST:
-                            byte2 = 0b11000000 | 0b00100000 | regd.id;
+                            byte2 = 0b11000000 | 0b00100000 | regd->id;
                             break;
                         case SHR_INST:
-                            byte2 = 0b11000000 | 0b00101000 | regd.id;
+                            byte2 = 0b11000000 | 0b00101000 | regd->id;
                             break;
                     }
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
+                    INSN_PUT(insn, byte1);
+                    INSN_PUT(insn, byte2);
                 }else{
                     PrintError(COLOR_BOLDRED, "Line %d :: Operand type mismatch!\n", LN);
                     return FALSE;
@@ -2560,150 +2545,148 @@ Boolean_t EncodeShiftRotateBlock(uint8_t mode, uint8_t inst, Register_t regd, Re
             }
             break;
         case MODE_MEM:
-            if( (mem.size == SZ_BYTE) || (mem.size == SZ_WORD) ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){
+            if( (mem->size == SZ_BYTE) || (mem->size == SZ_WORD) ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
-                        uint8_t byte2 = (mem.size == SZ_BYTE) ? 0xD0 : 0xD1;
+                        uint8_t byte2 = (mem->size == SZ_BYTE) ? 0xD0 : 0xD1;
                         uint8_t byte3;
                         switch(inst){
                             case RCL_INST:
-                                byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                             case RCR_INST:
-                                byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case ROL_INST:
-                                byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                 break;
                             case ROR_INST:
-                                byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                 break;
                             case SAL_INST:
-                                byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case SAR_INST:
-                                byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case SHL_INST:
-                                byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case SHR_INST:
-                                byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                         }
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
-                        uint8_t byte1 = (mem.size == SZ_BYTE) ? 0xD0 : 0xD1;
+                        uint8_t byte1 = (mem->size == SZ_BYTE) ? 0xD0 : 0xD1;
                         uint8_t byte2;
                         switch(inst){
                             case RCL_INST:
-                                byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                             case RCR_INST:
-                                byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case ROL_INST:
-                                byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                 break;
                             case ROR_INST:
-                                byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                 break;
                             case SAL_INST:
-                                byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case SAR_INST:
-                                byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case SHL_INST:
-                                byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case SHR_INST:
-                                byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                         }
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
-                        uint8_t byte2 = (mem.size == SZ_BYTE) ? 0xD0 : 0xD1;
+                        uint8_t byte2 = (mem->size == SZ_BYTE) ? 0xD0 : 0xD1;
                         uint8_t byte3;
                         switch(inst){
                             case RCL_INST:
-                                byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                             case RCR_INST:
-                                byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case ROL_INST:
-                                byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                 break;
                             case ROR_INST:
-                                byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                 break;
                             case SAL_INST:
-                                byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case SAR_INST:
-                                byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case SHL_INST:
-                                byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case SHR_INST:
-                                byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                         }
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
-                        uint8_t byte1 = (mem.size == SZ_BYTE) ? 0xD0 : 0xD1;
+                        uint8_t byte1 = (mem->size == SZ_BYTE) ? 0xD0 : 0xD1;
                         uint8_t byte2;
                         switch(inst){
                             case RCL_INST:
-                                byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                             case RCR_INST:
-                                byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case ROL_INST:
-                                byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                 break;
                             case ROR_INST:
-                                byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                 break;
                             case SAL_INST:
-                                byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case SAR_INST:
-                                byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case SHL_INST:
-                                byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case SHR_INST:
-                                byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                         }
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -2714,151 +2697,149 @@ Boolean_t EncodeShiftRotateBlock(uint8_t mode, uint8_t inst, Register_t regd, Re
                 isSOP = NSET;
             break;
         case MODE_MEM_REG:
-            if( (mem.size == SZ_BYTE) || (mem.size == SZ_WORD) ){
-                if( (regs.id == GPR_CLCX) && (regs.size == SZ_BYTE) ){
-                    if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){
+            if( (mem->size == SZ_BYTE) || (mem->size == SZ_WORD) ){
+                if( (regs->id == GPR_CLCX) && (regs->size == SZ_BYTE) ){
+                    if( mem->disps > 0 ){
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 5;
                             uint8_t byte1 = SOP;
-                            uint8_t byte2 = (mem.size == SZ_BYTE) ? 0xD2 : 0xD3;
+                            uint8_t byte2 = (mem->size == SZ_BYTE) ? 0xD2 : 0xD3;
                             uint8_t byte3;
                             switch(inst){
                                 case RCL_INST:
-                                    byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case RCR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case ROL_INST:
-                                    byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case ROR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SAL_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case SAR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case SHL_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case SHR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
-                            WriteByte2File(byte5);
+                            uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
+                            INSN_DISP(insn, byte4);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte5);
                         }else{
-                            SegmentTable[stsize-1].LC += 4;
-                            uint8_t byte1 = (mem.size == SZ_BYTE) ? 0xD2 : 0xD3;
+                            uint8_t byte1 = (mem->size == SZ_BYTE) ? 0xD2 : 0xD3;
                             uint8_t byte2;
                             switch(inst){
                                 case RCL_INST:
-                                    byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case RCR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case ROL_INST:
-                                    byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case ROR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SAL_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case SAR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case SHL_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case SHR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                             }
-                            uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                            uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
-                            WriteByte2File(byte4);
+                            uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                            uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_DISP(insn, byte3);
+                            if(mem->disps > 1)
+                                INSN_PUT(insn, byte4);
                         }
                     }else{
                         if(isSOP == SET){
-                            SegmentTable[stsize-1].LC += 3;
                             uint8_t byte1 = SOP;
-                            uint8_t byte2 = (mem.size == SZ_BYTE) ? 0xD2 : 0xD3;
+                            uint8_t byte2 = (mem->size == SZ_BYTE) ? 0xD2 : 0xD3;
                             uint8_t byte3;
                             switch(inst){
                                 case RCL_INST:
-                                    byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case RCR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case ROL_INST:
-                                    byte3 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case ROR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SAL_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case SAR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case SHL_INST:
-                                    byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case SHR_INST:
-                                    byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                             }
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
-                            WriteByte2File(byte3);
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
+                            INSN_PUT(insn, byte3);
                         }else{
-                            SegmentTable[stsize-1].LC += 2;
-                            uint8_t byte1 = (mem.size == SZ_BYTE) ? 0xD2 : 0xD3;
+                            uint8_t byte1 = (mem->size == SZ_BYTE) ? 0xD2 : 0xD3;
                             uint8_t byte2;
                             switch(inst){
                                 case RCL_INST:
-                                    byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                     break;
                                 case RCR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                     break;
                                 case ROL_INST:
-                                    byte2 = (mem.mod << 6) | 0b00000000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00000000 | mem->rm;
                                     break;
                                 case ROR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00001000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00001000 | mem->rm;
                                     break;
                                 case SAL_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case SAR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                     break;
                                 case SHL_INST:
-                                    byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                     break;
                                 case SHR_INST:
-                                    byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                    byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                     break;
                             }
-                            WriteByte2File(byte1);
-                            WriteByte2File(byte2);
+                            INSN_PUT(insn, byte1);
+                            INSN_PUT(insn, byte2);
                         }
                     }
                 }else{
@@ -2877,115 +2858,126 @@ Boolean_t EncodeShiftRotateBlock(uint8_t mode, uint8_t inst, Register_t regd, Re
             return FALSE;
             break;
     }
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeInterrupt(Immediate_t imm)
+Boolean_t EncodeInterrupt(const Operand_t *op)
 {
-    if(imm.size == SZ_BYTE){
-        if(imm.val == 3){
-            SegmentTable[stsize-1].LC += 1;
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_INT, MODE_IMM, 0, op) == TRUE)
+        return TRUE;
+    if(imm->size == SZ_BYTE){
+        if(imm->val == 3){
             uint8_t byte1 = 0xCC;
-            WriteByte2File(byte1);
+            INSN_PUT(insn, byte1);
         }else{
-            SegmentTable[stsize-1].LC += 2;
             uint8_t byte1 = 0xCD;
-            uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
-            WriteByte2File(byte1);
-            WriteByte2File(byte2);
+            uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
+            INSN_PUT(insn, byte1);
+            INSN_IMM(insn, byte2);
         }
     }else{
         PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
         return FALSE;
     }
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeReturnBlock(uint8_t mode, uint8_t inst, Immediate_t imm)
+Boolean_t EncodeReturnBlock(uint8_t mode, uint8_t inst, const Operand_t *op)
 {
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_RETURN, mode, inst, op) == TRUE)
+        return TRUE;
     switch(mode){
         case MODE_NO_OPERAND:
-            SegmentTable[stsize-1].LC += 1;
             uint8_t byte1 = (inst == RETN_INST) ? 0xC3 : 0xCB;
-            WriteByte2File(byte1);
+            INSN_PUT(insn, byte1);
             break;
         case MODE_IMM:
-            if(imm.size == SZ_WORD){
-                SegmentTable[stsize-1].LC += 3;
+            if(imm->size == SZ_WORD){
                 uint8_t byte1 = (inst == RETN_INST) ? 0xC2 : 0xCA;
-                uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
-                uint8_t byte3 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
-                WriteByte2File(byte3);
+                uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
+                uint8_t byte3 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                INSN_PUT(insn, byte1);
+                INSN_IMM(insn, byte2);
+                INSN_PUT(insn, byte3);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
             }
+            break;
         default:
             PrintError(COLOR_BOLDRED, "Line %d :: Instruction-Operand Mismatch!\n", LN);
             return FALSE;
     }
 
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeTest(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm)
+Boolean_t EncodeTest(uint8_t mode, const Operand_t *op)
 {
+    const Operand_t *regd = &op[0], *regs = &op[1];
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_TEST, mode, 0, op) == TRUE)
+        return TRUE;
     switch(mode){
         case MODE_REG_REG:
-            if( regd.size == regs.size ){
-                SegmentTable[stsize-1].LC += 2;
-                uint8_t byte1 = (regd.size == SZ_BYTE) ? 0x84 : 0x85;
-                uint8_t byte2 = 0b11000000 | (regs.id << 3) | regd.id;
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
+            if( regd->size == regs->size ){
+                uint8_t byte1 = (regd->size == SZ_BYTE) ? 0x84 : 0x85;
+                uint8_t byte2 = 0b11000000 | (regs->id << 3) | regd->id;
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
             }
             break;
         case MODE_REG_MEM:
-            if( regd.size == mem.size ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            if( regd->size == mem->size ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
-                        uint8_t byte2 = (regd.size == SZ_BYTE) ? 0x84 : 0x85;
-                        uint8_t byte3 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte2 = (regd->size == SZ_BYTE) ? 0x84 : 0x85;
+                        uint8_t byte3 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
-                        uint8_t byte1 = (regd.size == SZ_BYTE) ? 0x84 : 0x85;
-                        uint8_t byte2 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte1 = (regd->size == SZ_BYTE) ? 0x84 : 0x85;
+                        uint8_t byte2 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
-                        uint8_t byte2 = (regd.size == SZ_BYTE) ? 0x84 : 0x85;
-                        uint8_t byte3 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte2 = (regd->size == SZ_BYTE) ? 0x84 : 0x85;
+                        uint8_t byte3 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
-                        uint8_t byte1 = (regd.size == SZ_BYTE) ? 0x84 : 0x85;
-                        uint8_t byte2 = (mem.mod << 6) | (regd.id << 3) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte1 = (regd->size == SZ_BYTE) ? 0x84 : 0x85;
+                        uint8_t byte2 = (mem->mod << 6) | (regd->id << 3) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -2996,47 +2988,43 @@ Boolean_t EncodeTest(uint8_t mode, Register_t regd, Register_t regs, Memory_t me
                 isSOP = NSET;
             break;
         case MODE_REG_IMM:
-            if(regd.size == SZ_BYTE){
-                if(imm.size == SZ_BYTE){
-                    if(regd.id == GPR_ALAX){
-                        SegmentTable[stsize-1].LC += 2;
+            if(regd->size == SZ_BYTE){
+                if(imm->size == SZ_BYTE){
+                    if(regd->id == GPR_ALAX){
                         uint8_t byte1 = 0xA8;
-                        uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
+                        INSN_PUT(insn, byte1);
+                        INSN_IMM(insn, byte2);
                     }else{
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = 0xF6;
-                        uint8_t byte2 = 0b11000000 | regd.id;
-                        uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte2 = 0b11000000 | regd->id;
+                        uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_IMM(insn, byte3);
                     }
                 }else{
                     PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                     return FALSE;
                 }
-            }else if(regd.size == SZ_WORD){
-                if(regd.id == GPR_ALAX){
-                    SegmentTable[stsize-1].LC += 3;
+            }else if(regd->size == SZ_WORD){
+                if(regd->id == GPR_ALAX){
                     uint8_t byte1 = 0xA9;
-                    uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
-                    uint8_t byte3 = (imm.size == SZ_BYTE) ? 0 : (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
+                    uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
+                    uint8_t byte3 = (imm->size == SZ_BYTE) ? 0 : (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                    INSN_PUT(insn, byte1);
+                    INSN_IMM(insn, byte2);
+                    INSN_PUT(insn, byte3);
                 }
                 else{
-                    SegmentTable[stsize-1].LC += 4;
                     uint8_t byte1 = 0xF7;
-                    uint8_t byte2 = 0b11000000 | regd.id;
-                    uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                    uint8_t byte4 = (imm.size == SZ_BYTE) ? 0 : (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
-                    WriteByte2File(byte4);
+                    uint8_t byte2 = 0b11000000 | regd->id;
+                    uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                    uint8_t byte4 = (imm->size == SZ_BYTE) ? 0 : (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                    INSN_PUT(insn, byte1);
+                    INSN_PUT(insn, byte2);
+                    INSN_IMM(insn, byte3);
+                    INSN_PUT(insn, byte4);
                 }
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Internal Error!\n", LN);
@@ -3044,113 +3032,109 @@ Boolean_t EncodeTest(uint8_t mode, Register_t regd, Register_t regs, Memory_t me
             }
             break;
         case MODE_MEM_IMM:
-            if( (mem.size == SZ_BYTE) && (imm.size == SZ_BYTE) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            if( (mem->size == SZ_BYTE) && (imm->size == SZ_BYTE) ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 6;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xF6;
-                        uint8_t byte3 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >>8) & 0x00FF );
-                        uint8_t byte6 = (uint8_t) (imm.val & 0x00FF);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
-                        WriteByte2File(byte6);
+                        uint8_t byte3 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >>8) & 0x00FF );
+                        uint8_t byte6 = (uint8_t) (imm->val & 0x00FF);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
+                        INSN_IMM(insn, byte6);
                     }else{
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = 0xF6;
-                        uint8_t byte2 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >>8) & 0x00FF );
-                        uint8_t byte5 = (uint8_t) (imm.val & 0x00FF);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte2 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >>8) & 0x00FF );
+                        uint8_t byte5 = (uint8_t) (imm->val & 0x00FF);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
+                        INSN_IMM(insn, byte5);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xF6;
-                        uint8_t byte3 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (imm.val & 0x00FF);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte3 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (imm->val & 0x00FF);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_IMM(insn, byte4);
                     }else{
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = 0xF6;
-                        uint8_t byte2 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte2 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_IMM(insn, byte3);
                     }
                 }
-            }else if( ((mem.size == SZ_WORD) && (imm.size == SZ_BYTE)) || ((mem.size == SZ_WORD) && (imm.size == SZ_WORD)) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            }else if( ((mem->size == SZ_WORD) && (imm->size == SZ_BYTE)) || ((mem->size == SZ_WORD) && (imm->size == SZ_WORD)) ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 7;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xF7;
-                        uint8_t byte3 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        uint8_t byte6 = (uint8_t) (imm.val & 0x00FF);
-                        uint8_t byte7 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
-                        WriteByte2File(byte6);
-                        WriteByte2File(byte7);
+                        uint8_t byte3 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        uint8_t byte6 = (uint8_t) (imm->val & 0x00FF);
+                        uint8_t byte7 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
+                        INSN_IMM(insn, byte6);
+                        INSN_PUT(insn, byte7);
                     }else{
-                        SegmentTable[stsize-1].LC += 6;
                         uint8_t byte1 = 0xF7;
-                        uint8_t byte2 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        uint8_t byte5 = (uint8_t) (imm.val & 0x00FF);
-                        uint8_t byte6 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
-                        WriteByte2File(byte6);
+                        uint8_t byte2 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        uint8_t byte5 = (uint8_t) (imm->val & 0x00FF);
+                        uint8_t byte6 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
+                        INSN_IMM(insn, byte5);
+                        INSN_PUT(insn, byte6);
                     }
                 }
                 else
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xF7;
-                        uint8_t byte3 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (imm.val & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (imm->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_IMM(insn, byte4);
+                        INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = 0xF7;
-                        uint8_t byte2 = (mem.mod << 6) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (imm.val & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (mem->mod << 6) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (imm->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_IMM(insn, byte3);
+                        INSN_PUT(insn, byte4);
                     }
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -3165,165 +3149,168 @@ Boolean_t EncodeTest(uint8_t mode, Register_t regd, Register_t regs, Memory_t me
             break;
     }
 
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeArithmetic2Block(uint8_t mode, uint8_t inst, Register_t reg, Memory_t mem)
+Boolean_t EncodeArithmetic2Block(uint8_t mode, uint8_t inst, const Operand_t *op)
 {
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_ARITH2, mode, inst, op) == TRUE)
+        return TRUE;
     switch(mode){
         case MODE_REG:
-            if( (reg.size == SZ_BYTE) || (reg.size == SZ_WORD) ){
-                SegmentTable[stsize-1].LC += 2;
-                uint8_t byte1 = (reg.size == SZ_BYTE) ? 0xF6 : 0xF7;
+            if( (reg->size == SZ_BYTE) || (reg->size == SZ_WORD) ){
+                uint8_t byte1 = (reg->size == SZ_BYTE) ? 0xF6 : 0xF7;
                 uint8_t byte2;
                 switch(inst){
                     case DIV_INST:
-                        byte2 = 0b11110000 | reg.id;
+                        byte2 = 0b11110000 | reg->id;
                         break;
                     case IDIV_INST:
-                        byte2 = 0b11111000 | reg.id;
+                        byte2 = 0b11111000 | reg->id;
                         break;
                     case IMUL_INST:
-                        byte2 = 0b11101000 | reg.id;
+                        byte2 = 0b11101000 | reg->id;
                         break;
                     case MUL_INST:
-                        byte2 = 0b11100000 | reg.id;
+                        byte2 = 0b11100000 | reg->id;
                         break;
                     case NEG_INST:
-                        byte2 = 0b11011000 | reg.id;
+                        byte2 = 0b11011000 | reg->id;
                         break;
                     case NOT_INST:
-                        byte2 = 0b11010000 | reg.id;
+                        byte2 = 0b11010000 | reg->id;
                         break;
                 }
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
             }
             break;
         case MODE_MEM:
-            if( (mem.size == SZ_BYTE) || (mem.size == SZ_WORD) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            if( (mem->size == SZ_BYTE) || (mem->size == SZ_WORD) ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
-                        uint8_t byte2 = (mem.size == SZ_BYTE) ? 0xF6 : 0xF7;
+                        uint8_t byte2 = (mem->size == SZ_BYTE) ? 0xF6 : 0xF7;
                         uint8_t byte3;
                         switch(inst){
                             case DIV_INST:
-                                byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                 break;
                             case IDIV_INST:
-                                byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case IMUL_INST:
-                                byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                             case MUL_INST:
-                                byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case NEG_INST:
-                                byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case NOT_INST:
-                                byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                         }
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
-                        uint8_t byte1 = (mem.size == SZ_BYTE) ? 0xF6 : 0xF7;
+                        uint8_t byte1 = (mem->size == SZ_BYTE) ? 0xF6 : 0xF7;
                         uint8_t byte2;
                         switch(inst){
                             case DIV_INST:
-                                byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                 break;
                             case IDIV_INST:
-                                byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case IMUL_INST:
-                                byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                             case MUL_INST:
-                                byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case NEG_INST:
-                                byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case NOT_INST:
-                                byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                         }
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
-                        uint8_t byte2 = (mem.size == SZ_BYTE) ? 0xF6 : 0xF7;
+                        uint8_t byte2 = (mem->size == SZ_BYTE) ? 0xF6 : 0xF7;
                         uint8_t byte3;
                         switch(inst){
                             case DIV_INST:
-                                byte3 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                 break;
                             case IDIV_INST:
-                                byte3 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case IMUL_INST:
-                                byte3 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                             case MUL_INST:
-                                byte3 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case NEG_INST:
-                                byte3 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case NOT_INST:
-                                byte3 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte3 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                         }
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
-                        uint8_t byte1 = (mem.size == SZ_BYTE) ? 0xF6 : 0xF7;
+                        uint8_t byte1 = (mem->size == SZ_BYTE) ? 0xF6 : 0xF7;
                         uint8_t byte2;
                         switch(inst){
                             case DIV_INST:
-                                byte2 = (mem.mod << 6) | 0b00110000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00110000 | mem->rm;
                                 break;
                             case IDIV_INST:
-                                byte2 = (mem.mod << 6) | 0b00111000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00111000 | mem->rm;
                                 break;
                             case IMUL_INST:
-                                byte2 = (mem.mod << 6) | 0b00101000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00101000 | mem->rm;
                                 break;
                             case MUL_INST:
-                                byte2 = (mem.mod << 6) | 0b00100000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00100000 | mem->rm;
                                 break;
                             case NEG_INST:
-                                byte2 = (mem.mod << 6) | 0b00011000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00011000 | mem->rm;
                                 break;
                             case NOT_INST:
-                                byte2 = (mem.mod << 6) | 0b00010000 | mem.rm;
+                                byte2 = (mem->mod << 6) | 0b00010000 | mem->rm;
                                 break;
                         }
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -3339,66 +3326,68 @@ Boolean_t EncodeArithmetic2Block(uint8_t mode, uint8_t inst, Register_t reg, Mem
             break;
     }
 
-    return FALSE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeIncDecBlock(uint8_t mode, uint8_t inst, Register_t reg, Memory_t mem)
+Boolean_t EncodeIncDecBlock(uint8_t mode, uint8_t inst, const Operand_t *op)
 {
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_INCDEC, mode, inst, op) == TRUE)
+        return TRUE;
     switch(mode){
         case MODE_REG:
-            if(reg.size == SZ_BYTE){
-                SegmentTable[stsize-1].LC += 2;
+            if(reg->size == SZ_BYTE){
                 uint8_t byte1 = 0xFE;
-                uint8_t byte2 = (inst == INC_INST) ? (0b11000000 | reg.id) : (0b11001000 | reg.id);
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
+                uint8_t byte2 = (inst == INC_INST) ? (0b11000000 | reg->id) : (0b11001000 | reg->id);
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
             }else{
-                SegmentTable[stsize-1].LC += 1;
-                uint8_t byte1 = (inst == INC_INST) ? (0b01000000 | reg.id) : (0b01001000 | reg.id);
-                WriteByte2File(byte1);
+                uint8_t byte1 = (inst == INC_INST) ? (0b01000000 | reg->id) : (0b01001000 | reg->id);
+                INSN_PUT(insn, byte1);
             }
             break;
         case MODE_MEM:
-            if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            if( mem->disps > 0 ){
                 if(isSOP == SOP){
-                    SegmentTable[stsize-1].LC += 5;
                     uint8_t byte1 = SOP;
-                    uint8_t byte2 = (mem.size == SZ_BYTE) ? 0xFE : 0xFF;
-                    uint8_t byte3 = (mem.mod << 6) | ( (inst == INC_INST) ? 0b00000000 : 0b00001000) | mem.rm;
+                    uint8_t byte2 = (mem->size == SZ_BYTE) ? 0xFE : 0xFF;
+                    uint8_t byte3 = (mem->mod << 6) | ( (inst == INC_INST) ? 0b00000000 : 0b00001000) | mem->rm;
                     
-                    uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                    uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
-                    WriteByte2File(byte4);
-                    WriteByte2File(byte5);
+                    uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                    uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                    INSN_PUT(insn, byte1);
+                    INSN_PUT(insn, byte2);
+                    INSN_PUT(insn, byte3);
+                    INSN_DISP(insn, byte4);
+                    if(mem->disps > 1)
+                        INSN_PUT(insn, byte5);
                 }else{
-                    SegmentTable[stsize-1].LC += 4;
-                    uint8_t byte1 = (mem.size == SZ_BYTE) ? 0xFE : 0xFF;
-                    uint8_t byte2 = (mem.mod << 6) | ((inst == INC_INST) ? 0b00000000 : 0b00001000) | mem.rm;
-                    uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                    uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
-                    WriteByte2File(byte4);
+                    uint8_t byte1 = (mem->size == SZ_BYTE) ? 0xFE : 0xFF;
+                    uint8_t byte2 = (mem->mod << 6) | ((inst == INC_INST) ? 0b00000000 : 0b00001000) | mem->rm;
+                    uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                    uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                    INSN_PUT(insn, byte1);
+                    INSN_PUT(insn, byte2);
+                    INSN_DISP(insn, byte3);
+                    if(mem->disps > 1)
+                        INSN_PUT(insn, byte4);
                 }
             }else{
                 if(isSOP == SOP){
-                    SegmentTable[stsize-1].LC += 3;
                     uint8_t byte1 = SOP;
-                    uint8_t byte2 = (mem.size == SZ_BYTE) ? 0xFE : 0xFF;
-                    uint8_t byte3 = (mem.mod << 6) | ((inst == INC_INST) ? 0b00000000 : 0b00001000) | mem.rm;
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
-                    WriteByte2File(byte3);
+                    uint8_t byte2 = (mem->size == SZ_BYTE) ? 0xFE : 0xFF;
+                    uint8_t byte3 = (mem->mod << 6) | ((inst == INC_INST) ? 0b00000000 : 0b00001000) | mem->rm;
+                    INSN_PUT(insn, byte1);
+                    INSN_PUT(insn, byte2);
+                    INSN_PUT(insn, byte3);
                 }else{
-                    SegmentTable[stsize-1].LC += 2;
-                    uint8_t byte1 = (mem.size == SZ_BYTE) ? 0xFE : 0xFF;
-                    uint8_t byte2 = (mem.mod << 6) | ((inst == INC_INST) ? 0b00000000 : 0b00001000) | mem.rm;
-                    WriteByte2File(byte1);
-                    WriteByte2File(byte2);
+                    uint8_t byte1 = (mem->size == SZ_BYTE) ? 0xFE : 0xFF;
+                    uint8_t byte2 = (mem->mod << 6) | ((inst == INC_INST) ? 0b00000000 : 0b00001000) | mem->rm;
+                    INSN_PUT(insn, byte1);
+                    INSN_PUT(insn, byte2);
                 }
             }
             if(isSOP == SET)
@@ -3409,95 +3398,104 @@ Boolean_t EncodeIncDecBlock(uint8_t mode, uint8_t inst, Register_t reg, Memory_t
             return FALSE;
             break;
     }
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
 Boolean_t EncodeSingleByteInst(uint8_t byte)
 {
-    SegmentTable[stsize-1].LC += 1;
-    WriteByte2File(byte);
-    return TRUE;
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    INSN_PUT(insn, byte);
+    return EmitInsn(&insn);
 }
 
 Boolean_t EncodeTwoByteInst(uint8_t byte1, uint8_t byte2)
 {
-    SegmentTable[stsize-1].LC += 2;
-    WriteByte2File(byte1);
-    WriteByte2File(byte2);
-    return TRUE;
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    INSN_PUT(insn, byte1);
+    INSN_PUT(insn, byte2);
+    return EmitInsn(&insn);
 }
 
-Boolean_t EncodeJccBlock(uint8_t byte1, Immediate_t imm)
+Boolean_t EncodeJccBlock(uint8_t byte1, const Operand_t *op)
 {
-    if(imm.size == SZ_BYTE){
-        SegmentTable[stsize-1].LC += 2;
-        uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
-        WriteByte2File(byte1);
-        WriteByte2File(byte2);
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_JCC, MODE_IMM, byte1, op) == TRUE)
+        return TRUE;
+    if(imm->size == SZ_BYTE){
+        uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
+        INSN_PUT(insn, byte1);
+        INSN_IMM(insn, byte2);
     }else{
         PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
         return FALSE;
     }
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeFarOp(uint8_t mode, uint8_t inst, Memory_t mem, Immediate_t imm1, Immediate_t imm2)
+Boolean_t EncodeFarOp(uint8_t mode, uint8_t inst, const Operand_t *op)
 {
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    const Operand_t *imm1 = &op[0], *imm2 = &op[1];
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_FAROP, mode, inst, op) == TRUE)
+        return TRUE;
     switch(mode){
         case MODE_IMM_IMM:
-            SegmentTable[stsize-1].LC += 5;
             uint8_t byte1 = (inst == CALLF_INST) ? 0x9A : 0xEA;
-            uint8_t byte2 = (uint8_t) (imm2.val & 0x00FF);
-            uint8_t byte3 = (uint8_t) ( (imm2.val >> 8) & 0x00FF );
-            uint8_t byte4 = (uint8_t) (imm1.val & 0x00FF);
-            uint8_t byte5 = (uint8_t) ( (imm1.val >> 8) & 0x00FF );
-            WriteByte2File(byte1);
-            WriteByte2File(byte2);
-            WriteByte2File(byte3);
-            WriteByte2File(byte4);
-            WriteByte2File(byte5);
+            uint8_t byte2 = (uint8_t) (imm2->val & 0x00FF);
+            uint8_t byte3 = (uint8_t) ( (imm2->val >> 8) & 0x00FF );
+            uint8_t byte4 = (uint8_t) (imm1->val & 0x00FF);
+            uint8_t byte5 = (uint8_t) ( (imm1->val >> 8) & 0x00FF );
+            INSN_PUT(insn, byte1);
+            INSN_IMM(insn, byte2);
+            INSN_PUT(insn, byte3);
+            INSN_SEG(insn, byte4);
+            INSN_PUT(insn, byte5);
             break;
         case MODE_MEM:
-            if( mem.size == SZ_DWORD ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            if( mem->size == SZ_DWORD ){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xFF;
-                        uint8_t byte3 = (mem.mod << 6) | ( (inst == CALLF_INST) ? 0b00011000 : 0b00101000 ) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (mem->mod << 6) | ( (inst == CALLF_INST) ? 0b00011000 : 0b00101000 ) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = 0xFF;
-                        uint8_t byte2 = (mem.mod << 6) | ( (inst == CALLF_INST) ? 0b00011000 : 0b00101000 ) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (mem->mod << 6) | ( (inst == CALLF_INST) ? 0b00011000 : 0b00101000 ) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 3;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xFF;
-                        uint8_t byte3 = (mem.mod << 6) | ( (inst == CALLF_INST) ? 0b00011000 : 0b00101000 ) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte3 = (mem->mod << 6) | ( (inst == CALLF_INST) ? 0b00011000 : 0b00101000 ) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
                         uint8_t byte1 = 0xFF;
-                        uint8_t byte2 = (mem.mod << 6) | ( (inst == CALLF_INST) ? 0b00011000 : 0b00101000 ) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte2 = (mem->mod << 6) | ( (inst == CALLF_INST) ? 0b00011000 : 0b00101000 ) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -3513,62 +3511,66 @@ Boolean_t EncodeFarOp(uint8_t mode, uint8_t inst, Memory_t mem, Immediate_t imm1
             break;
     }
 
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
-Boolean_t EncodeNearOp(uint8_t mode, uint8_t inst, Register_t reg, Memory_t mem, Immediate_t imm)
+Boolean_t EncodeNearOp(uint8_t mode, uint8_t inst, const Operand_t *op)
 {
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
+    InsnBytes_t insn;
+    insn.n = insn.disp = insn.imm = insn.seg = 0;
+    if(LookupEncoding(ENC_NEAROP, mode, inst, op) == TRUE)
+        return TRUE;
     switch(mode){
         case MODE_IMM:
-            SegmentTable[stsize-1].LC += 3;
             uint8_t byte1 = (inst == CALLN_INST) ? 0xE8 : 0xE9;
-            uint8_t byte2 = (uint8_t) (imm.val & 0x00FF);
-            uint8_t byte3 = (uint8_t) ( (imm.val >> 8) & 0x00FF );
-            WriteByte2File(byte1);
-            WriteByte2File(byte2);
-            WriteByte2File(byte3);
+            uint8_t byte2 = (uint8_t) (imm->val & 0x00FF);
+            uint8_t byte3 = (uint8_t) ( (imm->val >> 8) & 0x00FF );
+            INSN_PUT(insn, byte1);
+            INSN_IMM(insn, byte2);
+            INSN_PUT(insn, byte3);
             break;
         case MODE_MEM:
-            if(mem.size == SZ_WORD){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
+            if(mem->size == SZ_WORD){
+                if( mem->disps > 0 ){
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xFF;
-                        uint8_t byte3 = (mem.mod << 6) | ( (inst == CALLN_INST) ? 0b00010000 : 0b00100000 ) | mem.rm;
-                        uint8_t byte4 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte5 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
-                        WriteByte2File(byte5);
+                        uint8_t byte3 = (mem->mod << 6) | ( (inst == CALLN_INST) ? 0b00010000 : 0b00100000 ) | mem->rm;
+                        uint8_t byte4 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte5 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
+                        INSN_DISP(insn, byte4);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte5);
                     }else{
-                        SegmentTable[stsize-1].LC += 4;
                         uint8_t byte1 = 0xFF;
-                        uint8_t byte2 = (mem.mod << 6) | ( (inst == CALLN_INST) ? 0b00010000 : 0b00100000 ) | mem.rm;
-                        uint8_t byte3 = (uint8_t) (mem.disp & 0x00FF);
-                        uint8_t byte4 = (uint8_t) ( (mem.disp >> 8) & 0x00FF );
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
-                        WriteByte2File(byte4);
+                        uint8_t byte2 = (mem->mod << 6) | ( (inst == CALLN_INST) ? 0b00010000 : 0b00100000 ) | mem->rm;
+                        uint8_t byte3 = (uint8_t) (mem->val & 0x00FF);
+                        uint8_t byte4 = (uint8_t) ( (mem->val >> 8) & 0x00FF );
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_DISP(insn, byte3);
+                        if(mem->disps > 1)
+                            INSN_PUT(insn, byte4);
                     }
                 }else{
                     if(isSOP == SET){
-                        SegmentTable[stsize-1].LC += 5;
                         uint8_t byte1 = SOP;
                         uint8_t byte2 = 0xFF;
-                        uint8_t byte3 = (mem.mod << 6) | ( (inst == CALLN_INST) ? 0b00010000 : 0b00100000 ) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
-                        WriteByte2File(byte3);
+                        uint8_t byte3 = (mem->mod << 6) | ( (inst == CALLN_INST) ? 0b00010000 : 0b00100000 ) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
+                        INSN_PUT(insn, byte3);
                     }else{
-                        SegmentTable[stsize-1].LC += 2;
                         uint8_t byte1 = 0xFF;
-                        uint8_t byte2 = (mem.mod << 6) | ( (inst == CALLN_INST) ? 0b00010000 : 0b00100000 ) | mem.rm;
-                        WriteByte2File(byte1);
-                        WriteByte2File(byte2);
+                        uint8_t byte2 = (mem->mod << 6) | ( (inst == CALLN_INST) ? 0b00010000 : 0b00100000 ) | mem->rm;
+                        INSN_PUT(insn, byte1);
+                        INSN_PUT(insn, byte2);
                     }
                 }
             }else{
@@ -3579,13 +3581,12 @@ Boolean_t EncodeNearOp(uint8_t mode, uint8_t inst, Register_t reg, Memory_t mem,
                 isSOP = NSET;
             break;
         case MODE_REG:
-            if(reg.size == SZ_WORD){
-                SegmentTable[stsize-1].LC += 2;
+            if(reg->size == SZ_WORD){
                 uint8_t byte1 = 0xFF;
                 uint8_t byte2 = (inst == CALLN_INST) ? 0b11010000 : 0b11100000;
-                byte2 = byte2 | reg.id;
-                WriteByte2File(byte1);
-                WriteByte2File(byte2);
+                byte2 = byte2 | reg->id;
+                INSN_PUT(insn, byte1);
+                INSN_PUT(insn, byte2);
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return FALSE;
@@ -3597,10 +3598,33 @@ Boolean_t EncodeNearOp(uint8_t mode, uint8_t inst, Register_t reg, Memory_t mem,
             break;
     }
 
-    return TRUE;
+    return CacheInsn(&insn);
 }
 
 Boolean_t EncodeEscapeBlock(void)
 {
     return TRUE;
 }
+
+/* Lines pass 1 recorded in the IR, the operands are the ones its parser
+   built for the size and the ones this parser would build again */
+Boolean_t EncodeRecord(const IRRecord_t *ir)
+{
+    switch(ir->family){
+        case ENC_MOV:     return EncodeMov(ir->mode, ir->op);
+        case ENC_ARITH:   return EncodeArithmeticBlock(ir->mode, ir->inst, ir->op);
+        case ENC_STACK:   return EncodeStackBlock(ir->mode, ir->inst, ir->op);
+        case ENC_IO:      return EncodeIOBlock(ir->mode, ir->inst, ir->op);
+        case ENC_XCHG:    return EncodeXchg(ir->mode, ir->op);
+        case ENC_ADDRESS: return EncodeAddressBlock(ir->inst, ir->op);
+        case ENC_SHIFT:   return EncodeShiftRotateBlock(ir->mode, ir->inst, ir->op);
+        case ENC_INT:     return EncodeInterrupt(ir->op);
+        case ENC_RETURN:  return EncodeReturnBlock(ir->mode, ir->inst, ir->op);
+        case ENC_TEST:    return EncodeTest(ir->mode, ir->op);
+        case ENC_ARITH2:  return EncodeArithmetic2Block(ir->mode, ir->inst, ir->op);
+        case ENC_INCDEC:  return EncodeIncDecBlock(ir->mode, ir->inst, ir->op);
+        case ENC_FAROP:   return EncodeFarOp(ir->mode, ir->inst, ir->op);
+        case ENC_NEAROP:  return EncodeNearOp(ir->mode, ir->inst, ir->op);
+    }
+    return FALSE;
+}
@@ -0,0 +1,190 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../include/Definitions.h"
+#include "../../include/Assembler.h"
+#include "../../include/Options.h"
+
+#define HEX_LINEMAX    80           // Longest formatted record
+
+/* Output Functions */
+extern Sink_t *AddSink(const char *path, const char *mode);
+
+/* Function Declerations */
+Boolean_t OpenRecordSink(const char *path, uint8_t format, LCounter_t start, LCounter_t end);
+static void WriteRecords(Sink_t *sink, LCounter_t addr, const uint8_t *buf, size_t len);
+static void CloseRecords(Sink_t *sink);
+static void PutRecordByte(Sink_t *sink, LCounter_t addr, uint8_t byte);
+static void FlushRecord(Sink_t *sink);
+static char *PutHex(char *p, uint8_t byte);
+
+/* Record Variables */
+static char HexPairs[256][2];           // Two digits of every byte value
+
+
+
+/* Function Definitions */
+
+/* Records are produced while the encoders write, bytes are only collected
+   until a record is full or the next address is not contiguous, so gaps
+   such as zero TIMES fills take no records at all */
+Boolean_t OpenRecordSink(const char *path, uint8_t format, LCounter_t start, LCounter_t end)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    int idx;
+    for(idx=0; idx<256; idx++){
+        HexPairs[idx][0] = digits[idx >> 4];
+        HexPairs[idx][1] = digits[idx & 0x0F];
+    }
+
+    Records_t *rec = calloc(1, sizeof(Records_t));
+    Sink_t *sink = (rec) ? AddSink(path, "w") : NULL;
+    if(!sink){
+        free(rec);
+        return FALSE;
+    }
+    sink->write = WriteRecords;
+    sink->close = CloseRecords;
+    sink->state = rec;
+
+    rec->format = format;
+    rec->start = start;
+    if(rec->format == FORMAT_SREC){
+        rec->addrbytes = (end <= 0x10000) ? 2 : (end <= 0x1000000) ? 3 : 4;
+        fputs("S0030000FC\n", sink->file);     // Empty header record
+    }
+    return TRUE;
+}
+
+static void WriteRecords(Sink_t *sink, LCounter_t addr, const uint8_t *buf, size_t len)
+{
+    if(!buf)
+        return;                             // A gap, the next record starts after it
+    size_t idx;
+    for(idx=0; idx<len; idx++)
+        PutRecordByte(sink, addr+idx, buf[idx]);
+}
+
+static void CloseRecords(Sink_t *sink)
+{
+    Records_t *rec = sink->state;
+    char line[HEX_LINEMAX];
+    char *p = line;
+
+    FlushRecord(sink);
+
+    if(rec->format == FORMAT_IHEX){
+        fputs(":00000001FF\n", sink->file);
+        free(rec);
+        return;
+    }
+
+    // Record count, then the termination record carrying the start address
+    if(rec->count <= 0xFFFF){
+        uint8_t sum = 3 + (uint8_t)(rec->count >> 8) + (uint8_t) rec->count;
+        *p++ = 'S'; *p++ = '5';
+        p = PutHex(p, 3);
+        p = PutHex(p, rec->count >> 8);
+        p = PutHex(p, rec->count);
+        p = PutHex(p, ~sum);
+        *p++ = '\n';
+    }
+
+    uint8_t sum = rec->addrbytes + 1;
+    *p++ = 'S';
+    *p++ = (rec->addrbytes == 2) ? '9' : (rec->addrbytes == 3) ? '8' : '7';
+    p = PutHex(p, rec->addrbytes + 1);
+    int shift;
+    for(shift=(rec->addrbytes-1)*8; shift>=0; shift-=8){
+        p = PutHex(p, rec->start >> shift);
+        sum += (uint8_t)(rec->start >> shift);
+    }
+    p = PutHex(p, ~sum);
+    *p++ = '\n';
+
+    fwrite(line, sizeof(char), p-line, sink->file);
+    free(rec);
+}
+
+static void PutRecordByte(Sink_t *sink, LCounter_t addr, uint8_t byte)
+{
+    Records_t *rec = sink->state;
+    if( (rec->len > 0) && ( (addr != rec->addr+rec->len) || (rec->len == HEX_RECORDSIZE) ) )
+        FlushRecord(sink);
+    // Intel HEX records can not cross a 64 KB boundary
+    if( (rec->len > 0) && (rec->format == FORMAT_IHEX) && ((addr & 0xFFFF) == 0) )
+        FlushRecord(sink);
+
+    if(rec->len == 0)
+        rec->addr = addr;
+    rec->buf[rec->len++] = byte;
+    rec->sum += byte;
+}
+
+static void FlushRecord(Sink_t *sink)
+{
+    Records_t *rec = sink->state;
+    char line[HEX_LINEMAX + HEX_LINEMAX];
+    char *p = line;
+    SCounter_t idx;
+
+    if(rec->len == 0)
+        return;
+
+    if(rec->format == FORMAT_IHEX){
+        if( (rec->addr >> 16) != rec->upper ){
+            rec->upper = rec->addr >> 16;
+            uint8_t sum = 2 + 4 + (uint8_t)(rec->upper >> 8) + (uint8_t) rec->upper;
+            memcpy(p, ":02000004", 9);
+            p += 9;
+            p = PutHex(p, rec->upper >> 8);
+            p = PutHex(p, rec->upper);
+            p = PutHex(p, -sum);
+            *p++ = '\n';
+        }
+
+        uint8_t sum = rec->len + (uint8_t)(rec->addr >> 8) + (uint8_t) rec->addr + rec->sum;
+        *p++ = ':';
+        p = PutHex(p, rec->len);
+        p = PutHex(p, rec->addr >> 8);
+        p = PutHex(p, rec->addr);
+        *p++ = '0'; *p++ = '0';
+        for(idx=0; idx<rec->len; idx++)
+            p = PutHex(p, rec->buf[idx]);
+        p = PutHex(p, -sum);
+    }else{
+        uint8_t count = rec->addrbytes + rec->len + 1;
+        uint8_t sum = count + rec->sum;
+        *p++ = 'S';
+        *p++ = '0' + rec->addrbytes - 1;    // S1, S2 or S3
+        p = PutHex(p, count);
+        int shift;
+        for(shift=(rec->addrbytes-1)*8; shift>=0; shift-=8){
+            p = PutHex(p, rec->addr >> shift);
+            sum += (uint8_t)(rec->addr >> shift);
+        }
+        for(idx=0; idx<rec->len; idx++)
+            p = PutHex(p, rec->buf[idx]);
+        p = PutHex(p, ~sum);
+    }
+    *p++ = '\n';
+
+    fwrite(line, sizeof(char), p-line, sink->file);
+    rec->count++;
+    rec->len = 0;
+    rec->sum = 0;
+}
+
+static char *PutHex(char *p, uint8_t byte)
+{
+    p[0] = HexPairs[byte][0];
+    p[1] = HexPairs[byte][1];
+    return p+2;
+}
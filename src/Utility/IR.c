@@ -0,0 +1,197 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Assembler.h"
+#include "../../include/Tokens.h"
+
+/* IR Variables */
+static IRRecord_t *IRTable;
+static size_t irsize, ircap;
+static size_t IRCursor;             // Next record of pass 2
+static int IRShmId = -1;            // Records shared with pass 2
+
+/* Line State of Pass 1 */
+static Flag_t IRBuilding;           // Stops at the first syntax error
+static Flag_t IRLineStart;          // The next token starts a line
+static Flag_t IRCandidate;          // The line may still become a record
+static LCounter_t IRLines;          // Newlines scanned so far
+static LCounter_t IRLine;           // Line of the instruction being parsed
+
+extern Boolean_t erroneous;
+
+/* Error Functions/Variables */
+extern void ExternalError(char *format, ...);
+
+/* Function Declerations */
+Boolean_t StartIR(void);
+void NoteIRToken(int code, Boolean_t isInst);
+void RecordIR(uint8_t family, uint8_t mode, uint8_t inst, const Operand_t *op);
+void DropIR(void);
+size_t ShareIR(const char *path);
+void ReleaseIR(void);
+Boolean_t AttachIR(const char *path, size_t size);
+Boolean_t MatchIR(LCounter_t line);
+const IRRecord_t *TakeIR(void);
+void DetachIR(void);
+
+
+
+/* Function Definitions */
+
+Boolean_t StartIR(void)
+{
+    IRTable = malloc(IR_INITCAP*sizeof(IRRecord_t));
+    if(!IRTable){
+        ExternalError("Failed to allocate instruction records: ");
+        return FALSE;
+    }
+    ircap = IR_INITCAP;
+    irsize = 0;
+    IRLines = 0;
+    IRLineStart = SET;
+    IRCandidate = NSET;
+    IRBuilding = SET;
+    return TRUE;
+}
+
+/* Pass 1 shows every token it scans. A line is a candidate if it starts
+   with an instruction and names no symbol, pass 2 would only compute the
+   same operands again. A second instruction, a prefix, disqualifies it as
+   pass 2 would skip both. The parser may hold the newline already when it
+   records, so the line only changes with the token after it */
+void NoteIRToken(int code, Boolean_t isInst)
+{
+    if(IRBuilding == NSET)
+        return;
+    if(code == TK_NL){
+        IRLines++;
+        IRLineStart = SET;
+        return;
+    }
+    if(IRLineStart == SET){
+        IRLineStart = NSET;
+        IRLine = IRLines;
+        IRCandidate = (isInst == TRUE) ? SET : NSET;
+        return;
+    }
+    if( (isInst == TRUE) || (code == TK_SEGNAME) || (code == TK_LABEL) || (code == TK_HERE) )
+        IRCandidate = NSET;
+}
+
+// After the size of the instruction, errors of the line leave no record
+void RecordIR(uint8_t family, uint8_t mode, uint8_t inst, const Operand_t *op)
+{
+    if( (IRBuilding == NSET) || (IRCandidate == NSET) || (erroneous == TRUE) )
+        return;
+    IRCandidate = NSET;
+
+    if(irsize == ircap){
+        IRRecord_t *tmp = realloc(IRTable, (ircap << 1)*sizeof(IRRecord_t));
+        if(!tmp){
+            IRBuilding = NSET;      // Pass 2 parses the rest
+            return;
+        }
+        IRTable = tmp;
+        ircap <<= 1;
+    }
+    IRRecord_t *ir = &IRTable[irsize++];
+    ir->line = IRLine;
+    ir->family = family;
+    ir->mode = mode;
+    ir->inst = inst;
+    memcpy(ir->op, op, sizeof(ir->op));
+}
+
+/* A syntax error may be found after the instruction was recorded and
+   recovery may take other lines with it, records end there */
+void DropIR(void)
+{
+    if(IRBuilding == NSET)
+        return;
+    if( (irsize > 0) && (IRTable[irsize-1].line == IRLine) )
+        irsize--;
+    IRBuilding = NSET;
+}
+
+/* The records go to pass 2 like the tokens, in a segment keyed with 'I'.
+   Returns their size, 0 if there are none or they could not be shared */
+size_t ShareIR(const char *path)
+{
+    if( (IRTable == NULL) || (irsize == 0) )
+        return 0;
+
+    size_t size = irsize*sizeof(IRRecord_t);
+    key_t key = ftok(path, 'I');
+    if( (key == -1) || ((IRShmId = shmget(key, size, IPC_CREAT | 0644)) == -1) )
+        return 0;
+    IRRecord_t *shm = shmat(IRShmId, NULL, 0);
+    if(shm == (IRRecord_t *) -1){
+        ReleaseIR();
+        return 0;
+    }
+    memcpy(shm, IRTable, size);
+    shmdt(shm);
+    return size;
+}
+
+// Once pass 2 has exited
+void ReleaseIR(void)
+{
+    if(IRShmId != -1)
+        shmctl(IRShmId, IPC_RMID, NULL);
+    IRShmId = -1;
+    free(IRTable);
+    IRTable = NULL;
+    IRBuilding = NSET;
+}
+
+Boolean_t AttachIR(const char *path, size_t size)
+{
+    if(size % sizeof(IRRecord_t) != 0)
+        return FALSE;
+    key_t key = ftok(path, 'I');
+    int shmid = (key == -1) ? -1 : shmget(key, size, 0);
+    if(shmid == -1)
+        return FALSE;
+    IRRecord_t *shm = shmat(shmid, NULL, 0);
+    if(shm == (IRRecord_t *) -1)
+        return FALSE;
+    IRTable = shm;
+    irsize = size/sizeof(IRRecord_t);
+    IRCursor = 0;
+    return TRUE;
+}
+
+// Is there a record for the line, lines are asked in order
+Boolean_t MatchIR(LCounter_t line)
+{
+    while( (IRCursor < irsize) && (IRTable[IRCursor].line < line) )
+        IRCursor++;
+    return ( (IRCursor < irsize) && (IRTable[IRCursor].line == line) ) ? TRUE : FALSE;
+}
+
+// The record MatchIR() found
+const IRRecord_t *TakeIR(void)
+{
+    return &IRTable[IRCursor++];
+}
+
+void DetachIR(void)
+{
+    if(IRTable)
+        shmdt(IRTable);
+    IRTable = NULL;
+    irsize = 0;
+}
@@ -0,0 +1,63 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "../../include/Definitions.h"
+#include "../../include/Assembler.h"
+
+/* Parser Variables */
+extern LCounter_t LN;
+
+/* Error Functions */
+extern void PrintError(char *color, char *format, ...);
+
+/* Function Declerations */
+long int GetIncbinSize(char *path, long int offset, long int length);
+
+
+
+/* Function Definitions */
+
+/* Size of INCBIN "path", offset, length in bytes or -1 after printing the
+   reason. A negative length means up to the end of the file. The file is
+   never read, pass 1 only needs its size */
+long int GetIncbinSize(char *path, long int offset, long int length)
+{
+    struct stat st;
+
+    if(stat(path, &st) < 0){
+        PrintError(COLOR_BOLDRED, "Line %d :: INCBIN can not access %s!\n", LN, path);
+        return -1;
+    }
+    if(!S_ISREG(st.st_mode)){
+        PrintError(COLOR_BOLDRED, "Line %d :: INCBIN %s is not a regular file!\n", LN, path);
+        return -1;
+    }
+    if( (offset < 0) || (offset > st.st_size) ){
+        PrintError(COLOR_BOLDRED, "Line %d :: INCBIN offset is out of %s!\n", LN, path);
+        return -1;
+    }
+
+    long int size = st.st_size - offset;
+    if(length >= 0){
+        if(length > size){
+            PrintError(COLOR_BOLDRED, "Line %d :: INCBIN length exceeds %s!\n", LN, path);
+            return -1;
+        }
+        size = length;
+    }
+    if(size > SEGMENT_MAX){
+        PrintError(COLOR_BOLDRED, "Line %d :: INCBIN %s does not fit into a segment!\n", LN, path);
+        return -1;
+    }
+
+    return size;
+}
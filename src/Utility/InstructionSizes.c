@@ -19,7 +19,7 @@ extern Flag_t isSOP;                     // Is segment is overwritten
 extern Flag_t isORG;                     // Is ORG directive used
 extern uint8_t SOP;
 extern LCounter_t LN;
-extern MCounter_t LC;
+extern LCounter_t LC;
 
 /* Tables */
 extern Segment_t *SegmentTable;
@@ -43,30 +43,33 @@ Boolean_t CheckSignExtension(short int val);
 short int ComputeFactorial(short int number);
 
 /* Function Declerations */
-SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm, uint8_t sreg);   // MOV
-SCounter_t GetStackBlockSize(uint8_t mode, uint8_t inst, Register_t reg, uint8_t sreg, Memory_t mem);              // POP, PUSH
-SCounter_t GetXchgBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem);                         // XCHG
-SCounter_t GetIOBlockSize(uint8_t mode, Register_t reg, Immediate_t imm);                                          // INB, INW, OUTB, OUTW
-SCounter_t GetAddressBlockSize(uint8_t inst, Register_t reg, Memory_t mem);                                                      // LEA, LES, LDS
-SCounter_t GetArithmeticBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm);  // ADC, ADD, AND, CMP, OR, SBB, SUB, XOR
-SCounter_t GetShiftRotateBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem);                  // RCL, RCR, ROL, ROR, SAL, SAR, SHL, SHR
-SCounter_t GetIncDecBlockSize(uint8_t mode, Register_t reg, Memory_t mem);                                         // INC, DEC
-SCounter_t GetArithmetic2Size(uint8_t mode, Register_t reg, Memory_t mem);                                         // DIV, IDIV, MUL, IMUL, NEG, NOT
-SCounter_t GetReturnBlockSize(uint8_t mode, Immediate_t imm);                                                      // RETN, RETF
-SCounter_t GetTestSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm);             // TEST
-SCounter_t GetFarOpSize(uint8_t mode, Memory_t mem, Immediate_t imm1, Immediate_t imm2);                           // JMPF, CALLF
-SCounter_t GetNearOpSize(uint8_t mode, Register_t reg, Memory_t mem, Immediate_t imm);                             // JMPN, CALLN
-SCounter_t GetInterruptSize(Immediate_t imm);                                                                      // INT
+SCounter_t GetMovBlockSize(uint8_t mode, const Operand_t *op);                                                             // MOV
+SCounter_t GetStackBlockSize(uint8_t mode, uint8_t inst, const Operand_t *op);                                     // POP, PUSH
+SCounter_t GetXchgBlockSize(uint8_t mode, const Operand_t *op);                                                    // XCHG
+SCounter_t GetIOBlockSize(uint8_t mode, const Operand_t *op);                                                      // INB, INW, OUTB, OUTW
+SCounter_t GetAddressBlockSize(uint8_t inst, const Operand_t *op);                                                               // LEA, LES, LDS
+SCounter_t GetArithmeticBlockSize(uint8_t mode, const Operand_t *op);                                              // ADC, ADD, AND, CMP, OR, SBB, SUB, XOR
+SCounter_t GetShiftRotateBlockSize(uint8_t mode, const Operand_t *op);                                             // RCL, RCR, ROL, ROR, SAL, SAR, SHL, SHR
+SCounter_t GetIncDecBlockSize(uint8_t mode, const Operand_t *op);                                                  // INC, DEC
+SCounter_t GetArithmetic2Size(uint8_t mode, const Operand_t *op);                                                  // DIV, IDIV, MUL, IMUL, NEG, NOT
+SCounter_t GetReturnBlockSize(uint8_t mode, const Operand_t *op);                                                  // RETN, RETF
+SCounter_t GetTestSize(uint8_t mode, const Operand_t *op);                                                         // TEST
+SCounter_t GetFarOpSize(uint8_t mode, const Operand_t *op);                                                        // JMPF, CALLF
+SCounter_t GetNearOpSize(uint8_t mode, const Operand_t *op);                                                       // JMPN, CALLN
+SCounter_t GetInterruptSize(const Operand_t *op);                                                                  // INT
 SCounter_t GetEscapeBlockSize(void);                                                                               // ESC0-7
 
 /* FUNCTION DEFINITIONS */
-SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm, uint8_t sreg){
+SCounter_t GetMovBlockSize(uint8_t mode, const Operand_t *op){
+    const Operand_t *regd = &op[0], *regs = &op[1];
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
     SCounter_t ret;
     switch(mode){
         case MODE_REG_REG:
-            if( (regd.size == SZ_BYTE) && (regs.size == SZ_BYTE) ){              // Reg8, Reg8
+            if( (regd->size == SZ_BYTE) && (regs->size == SZ_BYTE) ){              // Reg8, Reg8
                 ret = 2;
-            }else if( (regd.size == SZ_WORD) && (regs.size == SZ_WORD) ){      // Reg16, Reg16
+            }else if( (regd->size == SZ_WORD) && (regs->size == SZ_WORD) ){      // Reg16, Reg16
                 ret = 2;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -74,25 +77,17 @@ SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memor
             }
             break;
         case MODE_REG_MEM:
-            if( (mem.size == SZ_BYTE) &&(regd.size == SZ_BYTE) ){
-                if( (mem.mod == 0) && (mem.rm == 6) && (regd.id == GPR_ALAX) ){     // Acc8, Mem8
+            if( (mem->size == SZ_BYTE) &&(regd->size == SZ_BYTE) ){
+                if( (mem->mod == 0) && (mem->rm == 6) && (regd->id == GPR_ALAX) ){     // Acc8, Mem8
                     ret = 3;
                 }else{
-                    if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){      // Reg8, Mem8
-                        ret = 4;
-                    }else{
-                        ret = 2;
-                    }
+                    ret = 2 + mem->disps;                                             // Reg8, Mem8
                 }
-            }else if( (mem.size == SZ_WORD) && (regd.size == SZ_WORD) ){
-                if( (mem.mod == 0) && (mem.rm == 6) && (regd.id == GPR_ALAX) ){     // Acc16, Mem16
+            }else if( (mem->size == SZ_WORD) && (regd->size == SZ_WORD) ){
+                if( (mem->mod == 0) && (mem->rm == 6) && (regd->id == GPR_ALAX) ){     // Acc16, Mem16
                     ret = 3;
                 }else{
-                    if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){      // Reg16, Mem16
-                        ret = 4;
-                    }else{
-                        ret = 2;
-                    }
+                    ret = 2 + mem->disps;                                             // Reg16, Mem16
                 }
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -105,25 +100,17 @@ SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memor
             }
             break;
         case MODE_MEM_REG:
-            if( (mem.size == SZ_BYTE) && (regs.size == SZ_BYTE) ){
-                if( (mem.mod == 0) && (mem.rm == 6) && (regs.id == GPR_ALAX) ){
+            if( (mem->size == SZ_BYTE) && (regs->size == SZ_BYTE) ){
+                if( (mem->mod == 0) && (mem->rm == 6) && (regs->id == GPR_ALAX) ){
                     ret = 3;
                 }else{
-                    if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){      // Reg16, Mem16
-                        ret = 4;
-                    }else{
-                        ret = 2;
-                    }
+                    ret = 2 + mem->disps;                                             // Reg16, Mem16
                 }
-            }else if( (mem.size == SZ_WORD) && (regs.size == SZ_WORD) ){
-                if( (mem.mod == 0) && (mem.rm == 6) && (regs.id == GPR_ALAX) ){     // Acc16, Mem16
+            }else if( (mem->size == SZ_WORD) && (regs->size == SZ_WORD) ){
+                if( (mem->mod == 0) && (mem->rm == 6) && (regs->id == GPR_ALAX) ){     // Acc16, Mem16
                     ret = 3;
                 }else{
-                    if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){      // Reg16, Mem16
-                        ret = 4;
-                    }else{
-                        ret = 2;
-                    }
+                    ret = 2 + mem->disps;                                             // Reg16, Mem16
                 }
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -136,9 +123,9 @@ SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memor
             }
             break;
         case MODE_REG_IMM:
-            if( (regd.size == SZ_BYTE) && (imm.size == SZ_BYTE) ){
+            if( (regd->size == SZ_BYTE) && (imm->size == SZ_BYTE) ){
                 ret = 2;
-            }else if( (regd.size == SZ_WORD) && ( (imm.size == SZ_BYTE) || (imm.size == SZ_WORD) ) ){
+            }else if( (regd->size == SZ_WORD) && ( (imm->size == SZ_BYTE) || (imm->size == SZ_WORD) ) ){
                 ret = 3;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -146,18 +133,10 @@ SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memor
             }
             break;
         case MODE_MEM_IMM:
-            if( (mem.size == SZ_BYTE) && (imm.size == SZ_BYTE) ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){
-                    ret = 5;
-                }else{
-                    ret = 3;
-                }
-            }else if( (mem.size == SZ_WORD) && ( (imm.size == SZ_BYTE) || (imm.size == SZ_WORD) ) ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){
-                    ret = 6;
-                }else{
-                    ret = 4;
-                }
+            if( (mem->size == SZ_BYTE) && (imm->size == SZ_BYTE) ){
+                ret = 3 + mem->disps;
+            }else if( (mem->size == SZ_WORD) && ( (imm->size == SZ_BYTE) || (imm->size == SZ_WORD) ) ){
+                ret = 4 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -169,7 +148,7 @@ SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memor
             }
             break;
         case MODE_SREG_REG:
-            if(regs.size == SZ_WORD){
+            if(regs->size == SZ_WORD){
                 ret = 2;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -177,12 +156,8 @@ SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memor
             }
             break;
         case MODE_SREG_MEM:
-            if( mem.size == SZ_WORD ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){
-                    ret = 4;
-                }else{
-                    ret = 2;
-                }
+            if( mem->size == SZ_WORD ){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -194,7 +169,7 @@ SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memor
             }
             break;
         case MODE_REG_SREG:
-            if(regd.size == SZ_WORD){
+            if(regd->size == SZ_WORD){
                 ret = 2;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -202,12 +177,8 @@ SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memor
             }
             break;
         case MODE_MEM_SREG:
-            if( mem.size == SZ_WORD ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) ){
-                    ret = 4;
-                }else{
-                    ret = 2;
-                }
+            if( mem->size == SZ_WORD ){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -227,11 +198,14 @@ SCounter_t GetMovBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memor
     return ret;
 }
 
-SCounter_t GetStackBlockSize(uint8_t mode, uint8_t inst, Register_t reg, uint8_t sreg, Memory_t mem){
+SCounter_t GetStackBlockSize(uint8_t mode, uint8_t inst, const Operand_t *op){
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    uint8_t sreg = OPERAND(op, OPERAND_SREG)->id;
     SCounter_t ret;
     switch(mode){
         case MODE_REG:
-            if(reg.size == SZ_WORD){
+            if(reg->size == SZ_WORD){
                 ret = 1;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand Size Mismatch!\n", LN);
@@ -251,11 +225,8 @@ SCounter_t GetStackBlockSize(uint8_t mode, uint8_t inst, Register_t reg, uint8_t
             }
             break;
         case MODE_MEM:
-            if(mem.size == SZ_WORD){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) )
-                    ret = 4;
-                else
-                    ret = 2;
+            if(mem->size == SZ_WORD){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand Size Mismatch!\n", LN);
                 return -1;
@@ -275,15 +246,17 @@ SCounter_t GetStackBlockSize(uint8_t mode, uint8_t inst, Register_t reg, uint8_t
     return ret;
 }
 
-SCounter_t GetXchgBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem){
+SCounter_t GetXchgBlockSize(uint8_t mode, const Operand_t *op){
+    const Operand_t *regd = &op[0], *regs = &op[1];
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
     SCounter_t ret;
     switch(mode){
         case MODE_REG_REG:
-            if( (regd.id == GPR_ALAX) && (regd.size == SZ_WORD) && (regs.size == SZ_WORD) ){
+            if( (regd->id == GPR_ALAX) && (regd->size == SZ_WORD) && (regs->size == SZ_WORD) ){
                 ret = 1;
-            }else if( (regd.size == SZ_BYTE) && (regs.size == SZ_BYTE) ){
+            }else if( (regd->size == SZ_BYTE) && (regs->size == SZ_BYTE) ){
                 ret = 2;
-            }else if( (regd.size == SZ_WORD) && (regs.size == SZ_WORD) ){
+            }else if( (regd->size == SZ_WORD) && (regs->size == SZ_WORD) ){
                 ret = 2;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -291,11 +264,8 @@ SCounter_t GetXchgBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memo
             }
             break;
         case MODE_MEM_REG:
-            if( mem.size == regs.size ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) )
-                    ret = 4;
-                else
-                    ret = 2;
+            if( mem->size == regs->size ){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -310,11 +280,13 @@ SCounter_t GetXchgBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memo
     return ret;
 }
 
-SCounter_t GetIOBlockSize(uint8_t mode, Register_t reg, Immediate_t imm){
+SCounter_t GetIOBlockSize(uint8_t mode, const Operand_t *op){
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
     SCounter_t ret;
     switch(mode){
         case MODE_IMM:
-            if( imm.size == SZ_BYTE ){
+            if( imm->size == SZ_BYTE ){
                 ret = 2;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -322,8 +294,8 @@ SCounter_t GetIOBlockSize(uint8_t mode, Register_t reg, Immediate_t imm){
             }
             break;
         case MODE_REG:
-            if( reg.size == SZ_WORD ){
-                if( reg.id == GPR_DLDX ){
+            if( reg->size == SZ_WORD ){
+                if( reg->id == GPR_DLDX ){
                     ret = 1;
                 }else{
                     PrintError(COLOR_BOLDRED, "Line %d :: Instruction-Operand mismatch!\n", LN);
@@ -343,40 +315,30 @@ SCounter_t GetIOBlockSize(uint8_t mode, Register_t reg, Immediate_t imm){
     return ret;
 }
 
-SCounter_t GetAddressBlockSize(uint8_t inst, Register_t reg, Memory_t mem){
+SCounter_t GetAddressBlockSize(uint8_t inst, const Operand_t *op){
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
     SCounter_t ret;
     switch(inst){
         case LEA_INST:
-            if( (reg.size == SZ_WORD) && (mem.size == SZ_WORD) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
-                    ret = 4;
-                }else{
-                    ret = 2;
-                }
+            if( (reg->size == SZ_WORD) && (mem->size == SZ_WORD) ){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
             }
             break;
         case LDS_INST:
-            if( (reg.size == SZ_WORD) && (mem.size == SZ_DWORD) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
-                    ret = 4;
-                }else{
-                    ret = 2;
-                }
+            if( (reg->size == SZ_WORD) && (mem->size == SZ_DWORD) ){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
             }
             break;
         case LES_INST:
-            if( (reg.size == SZ_WORD) && (mem.size == SZ_DWORD) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
-                    ret = 4;
-                }else{
-                    ret = 2;
-                }
+            if( (reg->size == SZ_WORD) && (mem->size == SZ_DWORD) ){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -394,12 +356,15 @@ SCounter_t GetAddressBlockSize(uint8_t inst, Register_t reg, Memory_t mem){
     return ret;
 }
 
-SCounter_t GetArithmeticBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm){
+SCounter_t GetArithmeticBlockSize(uint8_t mode, const Operand_t *op){
+    const Operand_t *regd = &op[0], *regs = &op[1];
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
     SCounter_t ret;
     Boolean_t sgx;
     switch(mode){
         case MODE_REG_REG:
-            if(regd.size == regs.size){
+            if(regd->size == regs->size){
                 ret = 2;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -407,12 +372,8 @@ SCounter_t GetArithmeticBlockSize(uint8_t mode, Register_t regd, Register_t regs
             }
             break;
         case MODE_REG_MEM:
-            if(regd.size == mem.size){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
-                    ret = 4;
-                }else{
-                    ret = 2;
-                }
+            if(regd->size == mem->size){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -423,12 +384,8 @@ SCounter_t GetArithmeticBlockSize(uint8_t mode, Register_t regd, Register_t regs
             }
             break;
         case MODE_MEM_REG:
-            if(regs.size == mem.size){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
-                    ret = 4;
-                }else{
-                    ret = 2;
-                }
+            if(regs->size == mem->size){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -439,25 +396,25 @@ SCounter_t GetArithmeticBlockSize(uint8_t mode, Register_t regd, Register_t regs
             }
             break;
         case MODE_REG_IMM:
-            sgx = CheckSignExtension(imm.val);
-            if( (regd.size == SZ_BYTE) && (imm.size == SZ_BYTE) ){
-                if(regd.id == GPR_ALAX){
+            sgx = CheckSignExtension(imm->val);
+            if( (regd->size == SZ_BYTE) && (imm->size == SZ_BYTE) ){
+                if(regd->id == GPR_ALAX){
                     ret = 2;    // Acc8, imm8
                 }else{
                     ret = 3;    // Reg8, Imm8
                 }
-            }else if( (regd.size == SZ_WORD) && (imm.size == SZ_BYTE) ){
-                if( (regd.id == GPR_ALAX) && (sgx == FALSE) ){
+            }else if( (regd->size == SZ_WORD) && (imm->size == SZ_BYTE) ){
+                if( (regd->id == GPR_ALAX) && (sgx == FALSE) ){
                     ret = 3;    // Acc16, imm8
-                }else if( (regd.id != GPR_ALAX) && (sgx == FALSE) ){
+                }else if( (regd->id != GPR_ALAX) && (sgx == FALSE) ){
                     ret = 4;    // Reg16, imm8
                 }else{
                     ret = 3;    // Reg16, imm8_sgx
                 }
-            }else if( (regd.size == SZ_WORD) && (imm.size == SZ_WORD) ){
-                if( (regd.id == GPR_ALAX) && (sgx == FALSE) ){
+            }else if( (regd->size == SZ_WORD) && (imm->size == SZ_WORD) ){
+                if( (regd->id == GPR_ALAX) && (sgx == FALSE) ){
                     ret = 2;    // Acc16, imm16
-                }else if( (regd.id != GPR_ALAX) && (sgx == FALSE) ){
+                }else if( (regd->id != GPR_ALAX) && (sgx == FALSE) ){
                     ret = 4;    // Reg16, imm16
                 }else{
                     ret = 3;    // Reg16, imm16_sgx
@@ -468,25 +425,13 @@ SCounter_t GetArithmeticBlockSize(uint8_t mode, Register_t regd, Register_t regs
             }
             break;
         case MODE_MEM_IMM:
-            sgx = CheckSignExtension(imm.val);
-            if( (mem.size == SZ_BYTE) && (imm.size == SZ_BYTE) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
-                    ret = 5;
-                }else{
-                    ret = 3;
-                }
-            }else if( (mem.size == SZ_WORD) && (imm.size == SZ_BYTE) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
-                    ret = (sgx == TRUE) ? 5 : 6;
-                }else{
-                    ret = (sgx == TRUE) ? 3 : 4;
-                }
-            }else if( (mem.size == SZ_WORD) && (imm.size == SZ_WORD) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
-                    ret = (sgx == TRUE) ? 5 : 6;
-                }else{
-                    ret = (sgx == TRUE) ? 3 : 4;
-                }
+            sgx = CheckSignExtension(imm->val);
+            if( (mem->size == SZ_BYTE) && (imm->size == SZ_BYTE) ){
+                ret = 3 + mem->disps;
+            }else if( (mem->size == SZ_WORD) && (imm->size == SZ_BYTE) ){
+                ret = ( (sgx == TRUE) ? 3 : 4 ) + mem->disps;
+            }else if( (mem->size == SZ_WORD) && (imm->size == SZ_WORD) ){
+                ret = ( (sgx == TRUE) ? 3 : 4 ) + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -505,11 +450,13 @@ SCounter_t GetArithmeticBlockSize(uint8_t mode, Register_t regd, Register_t regs
     return ret;
 }
 
-SCounter_t GetShiftRotateBlockSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem){
+SCounter_t GetShiftRotateBlockSize(uint8_t mode, const Operand_t *op){
+    const Operand_t *regd = &op[0], *regs = &op[1];
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
     SCounter_t ret;
     switch(mode){
         case MODE_REG:
-            if( (regd.size == SZ_BYTE) || (regd.size == SZ_WORD) )
+            if( (regd->size == SZ_BYTE) || (regd->size == SZ_WORD) )
                 ret = 2;
             else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -517,8 +464,8 @@ SCounter_t GetShiftRotateBlockSize(uint8_t mode, Register_t regd, Register_t reg
             }
             break;
         case MODE_REG_REG:
-            if( (regd.size == SZ_BYTE) || (regd.size == SZ_WORD) )
-                if( (regs.id == GPR_CLCX) && (regs.size == SZ_BYTE) )
+            if( (regd->size == SZ_BYTE) || (regd->size == SZ_WORD) )
+                if( (regs->id == GPR_CLCX) && (regs->size == SZ_BYTE) )
                     ret = 2;
                 else{
                     PrintError(COLOR_BOLDRED, "Line %d :: Operand type mismatch!\n", LN);
@@ -530,11 +477,8 @@ SCounter_t GetShiftRotateBlockSize(uint8_t mode, Register_t regd, Register_t reg
             }
             break;
         case MODE_MEM:
-            if( (mem.size == SZ_BYTE) || (mem.size == SZ_WORD) ){
-                if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) )
-                    ret = 4;
-                else
-                    ret = 2;
+            if( (mem->size == SZ_BYTE) || (mem->size == SZ_WORD) ){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -545,12 +489,9 @@ SCounter_t GetShiftRotateBlockSize(uint8_t mode, Register_t regd, Register_t reg
             }
             break;
         case MODE_MEM_REG:
-            if( (mem.size == SZ_BYTE) || (mem.size == SZ_WORD) ){
-                if( (regs.id == GPR_CLCX) && (regs.size == SZ_BYTE) ){
-                    if( ((mem.mod == 0) && (mem.rm == 6)) || (mem.mod != 0) )
-                        ret = 4;
-                    else
-                        ret = 2;
+            if( (mem->size == SZ_BYTE) || (mem->size == SZ_WORD) ){
+                if( (regs->id == GPR_CLCX) && (regs->size == SZ_BYTE) ){
+                    ret = 2 + mem->disps;
                 }else{
                     PrintError(COLOR_BOLDRED, "Line %d :: Operand type mismatch!\n", LN);
                     return -1;
@@ -572,22 +513,20 @@ SCounter_t GetShiftRotateBlockSize(uint8_t mode, Register_t regd, Register_t reg
     return ret;
 }
 
-SCounter_t GetIncDecBlockSize(uint8_t mode, Register_t reg, Memory_t mem){
+SCounter_t GetIncDecBlockSize(uint8_t mode, const Operand_t *op){
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
     SCounter_t ret;
     switch(mode){
         case MODE_REG:
-            if(reg.size == SZ_BYTE){
+            if(reg->size == SZ_BYTE){
                 ret = 2;
             }else{
                 ret = 1;
             }
             break;
         case MODE_MEM:
-            if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) ){
-                ret = 4;
-            }else{
-                ret = 2;
-            }
+            ret = 2 + mem->disps;
             if(isSOP == SET){
                 ret++;
                 isSOP = NSET;
@@ -601,11 +540,13 @@ SCounter_t GetIncDecBlockSize(uint8_t mode, Register_t reg, Memory_t mem){
     return ret;
 }
 
-SCounter_t GetArithmetic2Size(uint8_t mode, Register_t reg, Memory_t mem){
+SCounter_t GetArithmetic2Size(uint8_t mode, const Operand_t *op){
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
     SCounter_t ret;
     switch(mode){
         case MODE_REG:
-            if( (reg.size == SZ_BYTE) || (reg.size == SZ_WORD) )
+            if( (reg->size == SZ_BYTE) || (reg->size == SZ_WORD) )
                 ret = 2;
             else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -613,11 +554,8 @@ SCounter_t GetArithmetic2Size(uint8_t mode, Register_t reg, Memory_t mem){
             }
             break;
         case MODE_MEM:
-            if( (mem.size == SZ_BYTE) || (mem.size == SZ_WORD) )
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) )
-                    ret = 4;
-                else
-                    ret = 2;
+            if( (mem->size == SZ_BYTE) || (mem->size == SZ_WORD) )
+                ret = 2 + mem->disps;
             else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -636,14 +574,15 @@ SCounter_t GetArithmetic2Size(uint8_t mode, Register_t reg, Memory_t mem){
     return ret;
 }
 
-SCounter_t GetReturnBlockSize(uint8_t mode, Immediate_t imm){
+SCounter_t GetReturnBlockSize(uint8_t mode, const Operand_t *op){
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
     SCounter_t size;
     switch(mode){
         case MODE_NO_OPERAND:
             size = 1;
             break;
         case MODE_IMM:
-            if(imm.size == SZ_WORD){
+            if(imm->size == SZ_WORD){
                 size = 3;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -657,11 +596,14 @@ SCounter_t GetReturnBlockSize(uint8_t mode, Immediate_t imm){
     return size;
 }
 
-SCounter_t GetTestSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t mem, Immediate_t imm){
+SCounter_t GetTestSize(uint8_t mode, const Operand_t *op){
+    const Operand_t *regd = &op[0], *regs = &op[1];
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
     SCounter_t ret;
     switch(mode){
         case MODE_REG_REG:
-            if( regd.size == regs.size ){
+            if( regd->size == regs->size ){
                 ret = 2;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -669,11 +611,8 @@ SCounter_t GetTestSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t
             }
             break;
         case MODE_REG_MEM:
-            if( regd.size == mem.size ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) )
-                    ret = 4;
-                else
-                    ret = 2;
+            if( regd->size == mem->size ){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -684,15 +623,15 @@ SCounter_t GetTestSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t
             }
             break;
         case MODE_REG_IMM:
-            if(regd.size == SZ_BYTE){
-                if(imm.size == SZ_BYTE){
-                    ret = (regd.id == GPR_ALAX) ? 2 : 3;
+            if(regd->size == SZ_BYTE){
+                if(imm->size == SZ_BYTE){
+                    ret = (regd->id == GPR_ALAX) ? 2 : 3;
                 }else{
                     PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                     return -1;
                 }
-            }else if(regd.size == SZ_WORD){
-                if(regd.id == GPR_ALAX) ret = 3;
+            }else if(regd->size == SZ_WORD){
+                if(regd->id == GPR_ALAX) ret = 3;
                 else ret = 4;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Internal Error!\n", LN);
@@ -700,16 +639,10 @@ SCounter_t GetTestSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t
             }
             break;
         case MODE_MEM_IMM:
-            if( (mem.size == SZ_BYTE) && (imm.size == SZ_BYTE) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) )
-                    ret = 5;
-                else
-                    ret = 3;
-            }else if( ((mem.size == SZ_WORD) && (imm.size == SZ_BYTE)) || ((mem.size == SZ_WORD) && (imm.size == SZ_WORD)) ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) )
-                    ret = 6;
-                else
-                    ret = 4;
+            if( (mem->size == SZ_BYTE) && (imm->size == SZ_BYTE) ){
+                ret = 3 + mem->disps;
+            }else if( ((mem->size == SZ_WORD) && (imm->size == SZ_BYTE)) || ((mem->size == SZ_WORD) && (imm->size == SZ_WORD)) ){
+                ret = 4 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -728,18 +661,16 @@ SCounter_t GetTestSize(uint8_t mode, Register_t regd, Register_t regs, Memory_t
     return ret;
 }
 
-SCounter_t GetFarOpSize(uint8_t mode, Memory_t mem, Immediate_t imm1, Immediate_t imm2){
+SCounter_t GetFarOpSize(uint8_t mode, const Operand_t *op){
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
     SCounter_t ret;
     switch(mode){
         case MODE_IMM_IMM:
             ret = 5;
             break;
         case MODE_MEM:
-            if( mem.size == SZ_DWORD ){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) )
-                    ret = 4;
-                else
-                    ret = 2;
+            if( mem->size == SZ_DWORD ){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch\n", LN);
                 return -1;
@@ -758,18 +689,17 @@ SCounter_t GetFarOpSize(uint8_t mode, Memory_t mem, Immediate_t imm1, Immediate_
     return ret;
 }
 
-SCounter_t GetNearOpSize(uint8_t mode, Register_t reg, Memory_t mem, Immediate_t imm){
+SCounter_t GetNearOpSize(uint8_t mode, const Operand_t *op){
+    const Operand_t *reg = OPERAND(op, OPERAND_REG);
+    const Operand_t *mem = OPERAND(op, OPERAND_MEM);
     SCounter_t ret;
     switch(mode){
         case MODE_IMM:
             ret = 3;
             break;
         case MODE_MEM:
-            if(mem.size == SZ_WORD){
-                if( ( (mem.mod == 0) && (mem.rm == 6) ) || (mem.mod != 0) )
-                    ret = 4;
-                else
-                    ret = 2;
+            if(mem->size == SZ_WORD){
+                ret = 2 + mem->disps;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
                 return -1;
@@ -780,7 +710,7 @@ SCounter_t GetNearOpSize(uint8_t mode, Register_t reg, Memory_t mem, Immediate_t
             }
             break;
         case MODE_REG:
-            if(reg.size == SZ_WORD){
+            if(reg->size == SZ_WORD){
                 ret = 2;
             }else{
                 PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
@@ -796,9 +726,10 @@ SCounter_t GetNearOpSize(uint8_t mode, Register_t reg, Memory_t mem, Immediate_t
     return ret;
 }
 
-SCounter_t GetInterruptSize(Immediate_t imm){
-    if(imm.size == SZ_BYTE){
-        return (imm.val == 3) ? 1 : 2;
+SCounter_t GetInterruptSize(const Operand_t *op){
+    const Operand_t *imm = OPERAND(op, OPERAND_IMM);
+    if(imm->size == SZ_BYTE){
+        return (imm->val == 3) ? 1 : 2;
     }else{
         PrintError(COLOR_BOLDRED, "Line %d :: Operand size mismatch!\n", LN);
         return -1;
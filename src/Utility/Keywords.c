@@ -0,0 +1,117 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+
+#define KEYWORD_SLOTS  512          // Hash values, a power of two
+#define KEYWORD_MINLEN 2
+#define KEYWORD_MAXLEN 6
+
+/* Keyword Variables */
+static const char *KeywordNames[] = {
+#define KEYWORD(name, token) #name,
+#include "../../include/Keywords.def"
+#undef KEYWORD
+};
+#define KEYWORDS ( sizeof(KeywordNames)/sizeof(KeywordNames[0]) )
+
+/* Associated values of the characters, the hash of a keyword is its length
+   plus the values of its first three and last characters. Chosen so that
+   no two keywords share a slot, BuildKeywordSlots() checks it */
+static const uint8_t KeywordAsso[256] = {
+    ['0'] = 122, ['1'] = 14, ['2'] = 248, ['3'] = 151, ['4'] = 45, ['5'] = 242,
+    ['6'] = 254, ['7'] = 114, ['a'] = 18, ['b'] = 127, ['c'] = 68, ['d'] = 79,
+    ['e'] = 213, ['f'] = 220, ['g'] = 0, ['h'] = 45, ['i'] = 126, ['j'] = 75,
+    ['k'] = 150, ['l'] = 195, ['m'] = 77, ['n'] = 197, ['o'] = 125,
+    ['p'] = 123, ['r'] = 182, ['s'] = 129, ['t'] = 218, ['u'] = 50, ['v'] = 20,
+    ['w'] = 33, ['x'] = 155, ['y'] = 215, ['z'] = 159
+};
+
+static uint8_t KeywordSlots[KEYWORD_SLOTS];     // Keyword index + 1, 0 if none
+static uint8_t KeywordLengths[KEYWORDS];
+static Boolean_t KeywordsReady;
+
+/* Error Functions/Variables */
+extern uint8_t errcode;
+extern void InternalError(char *format, ...);
+extern void ExitSafely(int retcode);
+
+/* Function Declerations */
+int MatchKeyword(const char *text, size_t len, size_t *matched);
+static int FindKeyword(const char *text, size_t len);
+static LCounter_t HashKeyword(const char *text, size_t len);
+static void BuildKeywordSlots(void);
+
+
+
+/* Function Definitions */
+
+/* The scanners match identifiers as a whole and ask for the keyword. Like
+   the rules this replaces, the longest keyword the text starts with wins
+   and the scanner gives the rest back. Returns the keyword index or -1 */
+int MatchKeyword(const char *text, size_t len, size_t *matched)
+{
+    if(KeywordsReady == FALSE)
+        BuildKeywordSlots();
+
+    size_t try = (len < KEYWORD_MAXLEN) ? len : KEYWORD_MAXLEN;
+    for(; try>=KEYWORD_MINLEN; try--){
+        int kw = FindKeyword(text, try);
+        if(kw >= 0){
+            *matched = try;
+            return kw;
+        }
+    }
+    return -1;
+}
+
+static int FindKeyword(const char *text, size_t len)
+{
+    uint8_t slot = KeywordSlots[HashKeyword(text, len)];
+    if( (slot == 0) || (KeywordLengths[slot-1] != len) )
+        return -1;
+
+    const char *name = KeywordNames[slot-1];
+    size_t idx;
+    for(idx=0; idx<len; idx++)
+        if( (uint8_t) (text[idx] | 0x20) != (uint8_t) (name[idx] | 0x20) )
+            return -1;
+    return slot-1;
+}
+
+/* Identifiers are letters and digits. OR-ing 0x20 lower-cases letters and
+   leaves digits as they are, so there is no branch on the case */
+static LCounter_t HashKeyword(const char *text, size_t len)
+{
+    LCounter_t hash = len;
+    hash += KeywordAsso[(uint8_t) (text[0] | 0x20)];
+    hash += KeywordAsso[(uint8_t) (text[1] | 0x20)];
+    if(len > 2)
+        hash += KeywordAsso[(uint8_t) (text[2] | 0x20)];
+    hash += KeywordAsso[(uint8_t) (text[len-1] | 0x20)];
+    return hash & (KEYWORD_SLOTS-1);
+}
+
+static void BuildKeywordSlots(void)
+{
+    size_t kw;
+    for(kw=0; kw<KEYWORDS; kw++){
+        KeywordLengths[kw] = strlen(KeywordNames[kw]);
+        LCounter_t hash = HashKeyword(KeywordNames[kw], KeywordLengths[kw]);
+        if(KeywordSlots[hash] != 0){
+            errcode = ERR_KEYWORDHASH;
+            InternalError("Error: %s: ", KeywordNames[kw]);
+            ExitSafely(EXIT_FAILURE);
+        }
+        KeywordSlots[hash] = kw+1;
+    }
+    KeywordsReady = TRUE;
+}
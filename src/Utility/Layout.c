@@ -0,0 +1,101 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Assembler.h"
+#include "../../include/Options.h"
+
+/* Tables */
+extern Segment_t *SegmentTable;
+extern size_t stsize;
+
+/* Options */
+extern Options_t Options;
+
+/* Symbol Map */
+extern void WriteSegmentMap(FILE *fmap);
+extern Boolean_t WriteLabelMap(FILE *fmap);
+extern LCounter_t GetLayoutSize(void);
+extern Boolean_t WalkLabelsByAddress(FILE *out, void (*visit)(FILE *out, size_t nth, const Label_t *label, const Segment_t *seg, LCounter_t addr, LCounter_t size));
+
+/* Function Declerations */
+Boolean_t PrintLayout(FILE *out);
+static Boolean_t PrintLayoutJSON(FILE *out);
+static void PutLabelJSON(FILE *out, size_t nth, const Label_t *label, const Segment_t *seg, LCounter_t addr, LCounter_t size);
+static void PutString(FILE *out, const char *str);
+
+
+
+/* Function Definitions */
+
+/* --size-only and --symbols-only, the layout pass 1 computed. Segment sizes
+   must already be set from their LC. The text is the format of the symbol
+   map, the JSON is a single object */
+Boolean_t PrintLayout(FILE *out)
+{
+    if(Options.json == SET)
+        return PrintLayoutJSON(out);
+
+    WriteSegmentMap(out);
+    fprintf(out, "%10s  %08X  (%u bytes)\n", "Image", GetLayoutSize(), GetLayoutSize());
+    if(Options.layout == LAYOUT_SYMBOLS){
+        fprintf(out, "\n");
+        return WriteLabelMap(out);
+    }
+    return TRUE;
+}
+
+// {"segments":[{"name","address","size"}...],"size":n,"labels":[...]}
+static Boolean_t PrintLayoutJSON(FILE *out)
+{
+    size_t idx;
+    fprintf(out, "{\"segments\":[");
+    for(idx=0; idx<stsize; idx++){
+        fprintf(out, "%s{\"name\":", (idx > 0) ? "," : "");
+        PutString(out, SegmentTable[idx].name);
+        fprintf(out, ",\"address\":%u,\"size\":%u}", SegmentTable[idx].loc, SegmentTable[idx].size);
+    }
+    fprintf(out, "],\"size\":%u", GetLayoutSize());
+
+    if(Options.layout == LAYOUT_SYMBOLS){
+        fprintf(out, ",\"labels\":[");
+        if(WalkLabelsByAddress(out, PutLabelJSON) == FALSE)
+            return FALSE;
+        fprintf(out, "]");
+    }
+
+    fprintf(out, "}\n");
+    return (ferror(out)) ? FALSE : TRUE;
+}
+
+static void PutLabelJSON(FILE *out, size_t nth, const Label_t *label, const Segment_t *seg, LCounter_t addr, LCounter_t size)
+{
+    fprintf(out, "%s{\"name\":", (nth > 0) ? "," : "");
+    PutString(out, label->name);
+    fprintf(out, ",\"segment\":");
+    PutString(out, seg->name);
+    fprintf(out, ",\"offset\":%u,\"address\":%u,\"size\":%u}", label->loc, addr, size);
+}
+
+// Names are plain identifiers, quoting is only a precaution
+static void PutString(FILE *out, const char *str)
+{
+    putc('"', out);
+    for(; *str; str++){
+        if( (*str == '"') || (*str == '\\') )
+            fprintf(out, "\\%c", *str);
+        else if( (uint8_t) *str < 0x20 )
+            fprintf(out, "\\u%04x", (uint8_t) *str);
+        else
+            putc(*str, out);
+    }
+    putc('"', out);
+}
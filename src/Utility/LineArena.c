@@ -0,0 +1,75 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../include/Definitions.h"
+
+/* Error Functions */
+extern void ExternalError(char *format, ...);
+
+/* Function Declerations */
+char *LineStrdup(const char *str, size_t len);
+void NextLineArena(void);
+
+/* Token strings of the current and the previous line. The parser may still
+   reduce the previous line while the scanner reads one token ahead, so a
+   generation is reused only after two newlines */
+static LineBlock_t *Generation[2];
+static SCounter_t CurGen;
+
+
+
+/* Function Definitions */
+
+char *LineStrdup(const char *str, size_t len)
+{
+    LineBlock_t *blk = Generation[CurGen];
+
+    if( (blk == NULL) || (blk->size - blk->used < len+1) ){
+        size_t size = (len+1 > LINEBLOCK_SIZE) ? len+1 : LINEBLOCK_SIZE;
+        LineBlock_t *tmp = malloc(sizeof(LineBlock_t) + size);
+        if(!tmp){
+            ExternalError("Failed to allocate token string: ");
+            exit(EXIT_FAILURE);
+        }
+        tmp->next = blk;
+        tmp->used = 0;
+        tmp->size = size;
+        Generation[CurGen] = blk = tmp;
+    }
+
+    char *copy = blk->data + blk->used;
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+    blk->used += len+1;
+
+    return copy;
+}
+
+// Called by the scanners for every newline token
+void NextLineArena(void)
+{
+    CurGen ^= 1;
+
+    LineBlock_t *blk = Generation[CurGen];
+    if(blk == NULL)
+        return;
+
+    // Keep a single ordinary block for reuse, release the rest
+    while( (blk->next != NULL) || (blk->size > LINEBLOCK_SIZE) ){
+        LineBlock_t *next = blk->next;
+        free(blk);
+        blk = next;
+        if(blk == NULL)
+            break;
+    }
+    if(blk)
+        blk->used = 0;
+    Generation[CurGen] = blk;
+}
@@ -0,0 +1,142 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Assembler.h"
+#include "../../include/Options.h"
+
+/* Listing Variables */
+FILE *flist;                        // Listing file, owned by its sink
+static Span_t LineSpan;             // Bytes of the current line
+static FILE *flsrc;                 // Second reader of the preprocessed file
+static char *SrcLine;               // Line read from flsrc
+static size_t SrcLineCap;
+static LCounter_t ListedLines;      // Source lines listed so far
+
+/* Tables */
+extern Segment_t *SegmentTable;
+extern size_t CurrentSegment;
+
+/* Options */
+extern Options_t Options;
+
+/* Output Functions */
+extern Sink_t *AddSink(const char *path, const char *mode);
+
+/* Error Functions/Variables */
+extern LCounter_t LN;
+
+/* Function Declerations */
+Boolean_t OpenListing(const char *src);
+void ListLine(Boolean_t located);
+static void ListBytes(Sink_t *sink, LCounter_t addr, const uint8_t *buf, size_t len);
+static void CloseListing(Sink_t *sink);
+static void PutSourceLine(void);
+
+
+
+/* Function Definitions */
+
+/* The listing is a sink written while pass 2 encodes, the source text
+   comes from a second reader of the preprocessed file so the scanner keeps
+   its own buffer. Both files are buffered like the streaming input */
+Boolean_t OpenListing(const char *src)
+{
+    flsrc = fopen(src, "r");
+    if(!flsrc)
+        return FALSE;
+    Sink_t *sink = AddSink(Options.listing, "w");
+    if(!sink){
+        fclose(flsrc);
+        flsrc = NULL;
+        return FALSE;
+    }
+    sink->write = ListBytes;
+    sink->close = CloseListing;
+    flist = sink->file;
+
+    setvbuf(flsrc, NULL, _IOFBF, STREAM_BUFSIZE);
+    fprintf(flist, "%6s  %6s  %8s  %-16s  %s\n", "Line", "Offset", "Size", "Bytes", "Source");
+    return TRUE;
+}
+
+/* Called by the parser when line LN is done. Lines the parser skipped are
+   listed without bytes first. located lines show their segment relative
+   LC at the start of the line, then the size and the first bytes they
+   emitted */
+void ListLine(Boolean_t located)
+{
+    if(!flist)
+        return;
+
+    while(ListedLines < LN){
+        fprintf(flist, "%6u%38s", ListedLines+1, "");
+        PutSourceLine();
+    }
+
+    if(located == TRUE){
+        LCounter_t offset = SegmentTable[CurrentSegment].LC - LineSpan.length;
+        char hex[2*LISTING_BYTES+1];
+        SCounter_t idx;
+        SCounter_t shown = (LineSpan.length < LISTING_BYTES) ? LineSpan.length : LISTING_BYTES;
+        for(idx=0; idx<shown; idx++)
+            sprintf(hex+2*idx, "%02X", LineSpan.bytes[idx]);
+        hex[2*shown] = '\0';
+
+        if(LineSpan.length > 0)
+            fprintf(flist, "%6u    %04X  %8u  %-16s  ", LN+1, offset, LineSpan.length, hex);
+        else
+            fprintf(flist, "%6u    %04X  %28s", LN+1, offset, "");
+    }else
+        fprintf(flist, "%6u%38s", LN+1, "");
+    PutSourceLine();
+
+    LineSpan.length = 0;
+}
+
+// Only the first LISTING_BYTES of a line are kept, NULL is a run of zeros
+static void ListBytes(Sink_t *sink, LCounter_t addr, const uint8_t *buf, size_t len)
+{
+    size_t idx;
+    for(idx=0; (LineSpan.length + idx < LISTING_BYTES) && (idx < len); idx++)
+        LineSpan.bytes[LineSpan.length + idx] = (buf) ? buf[idx] : 0;
+    LineSpan.length += len;
+}
+
+// Lists whatever the parser did not reach, the output closes the file
+static void CloseListing(Sink_t *sink)
+{
+    int c;
+    while( (c = getc(flsrc)) != EOF ){
+        ungetc(c, flsrc);
+        fprintf(flist, "%6u%38s", ListedLines+1, "");
+        PutSourceLine();
+    }
+
+    fclose(flsrc);
+    flsrc = NULL;
+    flist = NULL;
+    free(SrcLine);
+    SrcLine = NULL;
+}
+
+// Copies the next source line, the listing keeps going if the source ends
+static void PutSourceLine(void)
+{
+    ssize_t len = getline(&SrcLine, &SrcLineCap, flsrc);
+    if(len > 0){
+        if(SrcLine[len-1] != '\n')
+            SrcLine[len++] = '\n';      // getline() leaves room for the terminator
+        fwrite(SrcLine, sizeof(char), len, flist);
+    }else
+        putc('\n', flist);
+    ListedLines++;
+}
@@ -0,0 +1,163 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdint.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Assembler.h"
+
+#define MZ_ENTRYLABEL ".start"      // Execution starts here, or at the first segment
+#define MZ_STACKSEG   "$stack"      // Segment used as the stack, or 64 KB after the image
+#define MZ_STACKPARAS 0x1000        // Paragraphs allocated for the default stack
+
+/* Fixup Variables */
+Fixup_t *FixupTable;                // Segment relocations in output order
+size_t ftsize;                      // Number of fixups
+LCounter_t SegmentRefs;             // Segment references counted by pass 1, an upper bound
+static Boolean_t FixupsSorted = TRUE;
+
+/* Tables */
+extern Segment_t *SegmentTable;
+extern Label_t *LabelTable;
+extern size_t CurrentSegment;
+extern size_t stsize;
+extern size_t ltsize;
+
+/* Error Functions/Variables */
+extern LCounter_t LN;
+extern void PrintError(char *color, char *format, ...);
+extern void ExternalError(char *format, ...);
+extern size_t CheckSegmentExistence(char *sname);
+
+/* Function Declerations */
+size_t GetMZHeaderSize(void);
+MCounter_t GetSegmentParagraph(size_t seg);
+Boolean_t AddSegmentFixup(MCounter_t offset);
+void BuildMZHeader(uint8_t *buf, size_t hdrsize, size_t filesize);
+static int CompareFixups(const void *a, const void *b);
+static void PutWord(uint8_t *p, MCounter_t word);
+
+
+
+/* Function Definitions */
+
+/* The header is reserved before pass 2 writes the first byte, so its size
+   comes from the references pass 1 counted rather than the fixups found */
+size_t GetMZHeaderSize(void)
+{
+    size_t size = MZ_HEADERSIZE + SegmentRefs*4;
+    return (size + MZ_PARAGRAPH - 1) & ~((size_t) MZ_PARAGRAPH - 1);
+}
+
+// Value of a segment reference, pass 1 aligned every segment to a paragraph
+MCounter_t GetSegmentParagraph(size_t seg)
+{
+    return (MCounter_t) ( (SegmentTable[seg].loc - SegmentTable[0].loc) / MZ_PARAGRAPH );
+}
+
+// Records the word at offset of the current segment, located by the parser
+Boolean_t AddSegmentFixup(MCounter_t offset)
+{
+    if(ftsize >= SegmentRefs){
+        PrintError(COLOR_BOLDRED, "Line %d :: More segment references than pass 1 counted!\n", LN);
+        return FALSE;
+    }
+
+    if(FixupTable == NULL){
+        FixupTable = malloc(SegmentRefs*sizeof(Fixup_t));
+        if(!FixupTable){
+            ExternalError("Failed to allocate relocation table: ");
+            return FALSE;
+        }
+    }
+
+    Fixup_t fix;
+    fix.offset  = offset;
+    fix.segment = GetSegmentParagraph(CurrentSegment);
+    if( (ftsize > 0) && (CompareFixups(&FixupTable[ftsize-1], &fix) > 0) )
+        FixupsSorted = FALSE;
+    FixupTable[ftsize++] = fix;
+
+    return TRUE;
+}
+
+/* Fills the reserved header: the fixed part, then the relocations sorted
+   by address, which is the order they were found unless segments were
+   reopened. filesize includes the header */
+void BuildMZHeader(uint8_t *buf, size_t hdrsize, size_t filesize)
+{
+    memset(buf, 0, hdrsize);
+
+    if(FixupsSorted == FALSE)
+        qsort(FixupTable, ftsize, sizeof(Fixup_t), CompareFixups);
+
+    MCounter_t cs = 0, ip = 0;
+    size_t idx;
+    for(idx=0; idx<ltsize; idx++){
+        if(strcasecmp(LabelTable[idx].name, MZ_ENTRYLABEL) == 0){
+            size_t seg = CheckSegmentExistence(LabelTable[idx].segname);
+            if(seg != (size_t) -1){
+                cs = GetSegmentParagraph(seg);
+                ip = LabelTable[idx].loc;
+            }
+            break;
+        }
+    }
+
+    size_t image = filesize - hdrsize;
+    MCounter_t ss = (MCounter_t) ( (image + MZ_PARAGRAPH - 1) / MZ_PARAGRAPH );
+    MCounter_t sp = 0;                      // Wraps to the top of the segment
+    MCounter_t minalloc = MZ_STACKPARAS;
+    for(idx=0; idx<stsize; idx++){
+        if(strcasecmp(SegmentTable[idx].name, MZ_STACKSEG) == 0){
+            ss = GetSegmentParagraph(idx);
+            sp = (MCounter_t) SegmentTable[idx].size;
+            minalloc = 0;
+            break;
+        }
+    }
+
+    buf[0] = 'M';
+    buf[1] = 'Z';
+    PutWord(buf+0x02, filesize % 512);                  // Bytes in the last page
+    PutWord(buf+0x04, (filesize + 511) / 512);          // Pages in the file
+    PutWord(buf+0x06, ftsize);                          // Relocations
+    PutWord(buf+0x08, hdrsize / MZ_PARAGRAPH);          // Header paragraphs
+    PutWord(buf+0x0A, minalloc);
+    PutWord(buf+0x0C, 0xFFFF);                          // Maximum allocation
+    PutWord(buf+0x0E, ss);
+    PutWord(buf+0x10, sp);
+    PutWord(buf+0x14, ip);
+    PutWord(buf+0x16, cs);
+    PutWord(buf+0x18, MZ_HEADERSIZE);                   // Relocation table offset
+
+    uint8_t *p = buf + MZ_HEADERSIZE;
+    for(idx=0; idx<ftsize; idx++){
+        PutWord(p, FixupTable[idx].offset);
+        PutWord(p+2, FixupTable[idx].segment);
+        p += 4;
+    }
+}
+
+static int CompareFixups(const void *a, const void *b)
+{
+    const Fixup_t *fa = a, *fb = b;
+    if(fa->segment != fb->segment)
+        return (fa->segment < fb->segment) ? -1 : 1;
+    if(fa->offset != fb->offset)
+        return (fa->offset < fb->offset) ? -1 : 1;
+    return 0;
+}
+
+static void PutWord(uint8_t *p, MCounter_t word)
+{
+    p[0] = (uint8_t) (word & 0x00FF);
+    p[1] = (uint8_t) (word >> 8);
+}
@@ -0,0 +1,185 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Assembler.h"
+#include "../../include/Object.h"
+
+#define RELOCTAB_INITCAP 256        // Initial number of relocations, grows by doubling
+#define EXTERNTAB_INITCAP 16        // Initial number of external symbols
+
+/* Object Variables */
+ObjReloc_t *RelocTable;             // Relocations in output order
+size_t rtsize;                      // Number of relocations
+static size_t rtcap;
+char **ExternTable;                 // Labels used but not defined by this source
+size_t etsize;                      // Number of external symbols
+static size_t etcap;
+
+/* Tables */
+extern Segment_t *SegmentTable;
+extern Label_t *LabelTable;
+extern size_t stsize;
+extern size_t ltsize;
+
+/* Error Functions/Variables */
+extern LCounter_t LN;
+extern void PrintError(char *color, char *format, ...);
+extern void ExternalError(char *format, ...);
+extern size_t CheckSegmentExistence(char *sname);
+
+/* Function Declerations */
+size_t AddExternSymbol(char *name);
+Boolean_t AddObjectRelocation(uint8_t kind, size_t target, size_t section, MCounter_t offset);
+size_t GetObjectHeaderSize(void);
+void BuildObjectHeader(uint8_t *buf, size_t tables);
+Boolean_t WriteObjectTables(FILE *file, size_t origin);
+static uint32_t GetStringTableSize(void);
+
+
+
+/* Function Definitions */
+
+// Index of an external symbol, registered by its first use
+size_t AddExternSymbol(char *name)
+{
+    size_t idx;
+    for(idx=0; idx<etsize; idx++)
+        if(strcmp(ExternTable[idx], name) == 0)
+            return idx;
+
+    if(etsize == etcap){
+        size_t newcap = (etcap == 0) ? EXTERNTAB_INITCAP : etcap << 1;
+        char **tmp = realloc(ExternTable, newcap*sizeof(char*));
+        if(!tmp){
+            ExternalError("Failed to allocate external symbols: ");
+            return (size_t) -1;
+        }
+        ExternTable = tmp;
+        etcap = newcap;
+    }
+
+    ExternTable[etsize] = strdup(name);     // Scanner copies only live for a line
+    if(!ExternTable[etsize]){
+        ExternalError("Failed to allocate external symbols: ");
+        return (size_t) -1;
+    }
+    return etsize++;
+}
+
+// Records the word at offset of section, located by the parser
+Boolean_t AddObjectRelocation(uint8_t kind, size_t target, size_t section, MCounter_t offset)
+{
+    if(rtsize == rtcap){
+        size_t newcap = (rtcap == 0) ? RELOCTAB_INITCAP : rtcap << 1;
+        ObjReloc_t *tmp = realloc(RelocTable, newcap*sizeof(ObjReloc_t));
+        if(!tmp){
+            ExternalError("Failed to allocate relocation table: ");
+            return FALSE;
+        }
+        RelocTable = tmp;
+        rtcap = newcap;
+    }
+
+    ObjReloc_t *rel = &RelocTable[rtsize++];
+    memset(rel, 0, sizeof(ObjReloc_t));
+    rel->section = section;
+    rel->offset = offset;
+    if(kind == REF_SEGMENT){
+        rel->type = RELOC_SEGMENT;
+        rel->target = target;
+    }else if(kind == REF_OFFSET){
+        rel->type = RELOC_OFFSET;
+        rel->target = target;
+    }else{
+        rel->type = RELOC_EXTERN;
+        rel->target = ltsize + target;      // Externals follow the labels
+    }
+
+    return TRUE;
+}
+
+size_t GetObjectHeaderSize(void)
+{
+    return sizeof(ObjHeader_t);
+}
+
+// The tables are written after the image, at offset tables
+void BuildObjectHeader(uint8_t *buf, size_t tables)
+{
+    ObjHeader_t hdr;
+    memset(&hdr, 0, sizeof(ObjHeader_t));
+    memcpy(hdr.magic, OBJ_MAGIC, 4);
+    hdr.version = OBJ_VERSION;
+    hdr.nsections = stsize;
+    hdr.nsymbols = ltsize + etsize;
+    hdr.nrelocs = rtsize;
+    hdr.strsize = GetStringTableSize();
+    hdr.tables = tables;
+    hdr.origin = (stsize > 0) ? SegmentTable[0].loc : 0;
+    memcpy(buf, &hdr, sizeof(ObjHeader_t));
+}
+
+/* Sections, symbols, relocations and the names they refer to. origin is the
+   file offset of the first section, the rest follow it as in a flat image */
+Boolean_t WriteObjectTables(FILE *file, size_t origin)
+{
+    uint32_t name = 0;
+    size_t idx;
+
+    for(idx=0; idx<stsize; idx++){
+        ObjSection_t sec;
+        sec.name = name;
+        sec.size = SegmentTable[idx].size;
+        sec.offset = origin + SegmentTable[idx].loc - SegmentTable[0].loc;
+        fwrite(&sec, sizeof(ObjSection_t), 1, file);
+        name += strlen(SegmentTable[idx].name) + 1;
+    }
+
+    for(idx=0; idx<ltsize+etsize; idx++){
+        ObjSymbol_t sym;
+        sym.name = name;
+        if(idx < ltsize){
+            sym.section = CheckSegmentExistence(LabelTable[idx].segname);
+            sym.value = LabelTable[idx].loc;
+            name += strlen(LabelTable[idx].name) + 1;
+        }else{
+            sym.section = OBJ_UNDEFINED;
+            sym.value = 0;
+            name += strlen(ExternTable[idx-ltsize]) + 1;
+        }
+        fwrite(&sym, sizeof(ObjSymbol_t), 1, file);
+    }
+
+    fwrite(RelocTable, sizeof(ObjReloc_t), rtsize, file);
+
+    for(idx=0; idx<stsize; idx++)
+        fwrite(SegmentTable[idx].name, sizeof(char), strlen(SegmentTable[idx].name)+1, file);
+    for(idx=0; idx<ltsize; idx++)
+        fwrite(LabelTable[idx].name, sizeof(char), strlen(LabelTable[idx].name)+1, file);
+    for(idx=0; idx<etsize; idx++)
+        fwrite(ExternTable[idx], sizeof(char), strlen(ExternTable[idx])+1, file);
+
+    return (ferror(file)) ? FALSE : TRUE;
+}
+
+static uint32_t GetStringTableSize(void)
+{
+    uint32_t size = 0;
+    size_t idx;
+    for(idx=0; idx<stsize; idx++)
+        size += strlen(SegmentTable[idx].name) + 1;
+    for(idx=0; idx<ltsize; idx++)
+        size += strlen(LabelTable[idx].name) + 1;
+    for(idx=0; idx<etsize; idx++)
+        size += strlen(ExternTable[idx]) + 1;
+    return size;
+}
@@ -0,0 +1,188 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Options.h"
+
+/* Option Variables */
+Options_t Options;                      // Decoded options
+char *OptionArgs[OPTIONS_MAX];          // Accepted option strings, forwarded to the next stage
+SCounter_t OptionCount;                 // Number of accepted options
+
+/* Error Functions/Variables */
+extern uint8_t errcode;
+extern void PrintError(char *color, char *format, ...);
+extern void InternalError(char *format, ...);
+extern void ExternalError(char *format, ...);
+extern void LimitDiagnostics(LCounter_t max);
+extern void FormatDiagnostics(uint8_t format);
+
+/* Formats of --emit */
+static const struct{
+    const char *name;
+    uint8_t format;
+}EmitFormats[] = {
+    {"bin",   FORMAT_BIN},
+    {"ihex",  FORMAT_IHEX},
+    {"srec",  FORMAT_SREC},
+    {"crc32", FORMAT_CRC32}
+};
+
+/* Function Declerations */
+int DecodeOption(int argc, char **argv);
+void DecodeOptions(int argc, char **argv);
+char **ComposeArguments(char *prog, ...);
+
+
+
+/* Function Definitions */
+
+/* Decodes the option at argv[0] together with its value. Returns the
+   number of arguments used, 0 if the option is not known */
+int DecodeOption(int argc, char **argv)
+{
+    int used = 1;
+
+    if(strcmp(argv[0], "--stream") == 0){
+        Options.stream = SET;
+    }else if(strcmp(argv[0], "--size-only") == 0){
+        Options.layout = LAYOUT_SIZES;
+    }else if(strcmp(argv[0], "--symbols-only") == 0){
+        Options.layout = LAYOUT_SYMBOLS;
+    }else if(strcmp(argv[0], "--json") == 0){
+        Options.json = SET;
+    }else if(strcmp(argv[0], "--stats") == 0){
+        Options.stats = SET;
+    }else if(strcmp(argv[0], "--emit-tokens") == 0){
+        Options.tokens = SET;
+    }else if(strcmp(argv[0], "--max-errors") == 0){
+        char *end = NULL;
+        long int max = (argc < 2) ? -1 : strtol(argv[1], &end, 10);
+        if( (max < 0) || (max > UINT32_MAX) || (end == argv[1]) || (*end != '\0') )
+            return 0;
+        Options.maxerrors = max;
+        LimitDiagnostics(Options.maxerrors);
+        used = 2;
+    }else if(strncmp(argv[0], "--diagnostics-format=", 21) == 0){
+        if(strcmp(argv[0]+21, "text") == 0)
+            Options.diagformat = DIAGFORMAT_TEXT;
+        else if(strcmp(argv[0]+21, "json") == 0)
+            Options.diagformat = DIAGFORMAT_JSON;
+        else
+            return 0;
+        FormatDiagnostics(Options.diagformat);
+    }else if(strcmp(argv[0], "-f") == 0){
+        if(argc < 2)
+            return 0;
+        if(strcmp(argv[1], "bin") == 0)
+            Options.format = FORMAT_BIN;
+        else if(strcmp(argv[1], "ihex") == 0)
+            Options.format = FORMAT_IHEX;
+        else if(strcmp(argv[1], "srec") == 0)
+            Options.format = FORMAT_SREC;
+        else if(strcmp(argv[1], "mz") == 0)
+            Options.format = FORMAT_MZ;
+        else if(strcmp(argv[1], "obj") == 0)
+            Options.format = FORMAT_OBJ;
+        else
+            return 0;
+        used = 2;
+    }else if(strcmp(argv[0], "-l") == 0){
+        if(argc < 2)
+            return 0;
+        Options.listing = argv[1];
+        used = 2;
+    }else if(strcmp(argv[0], "-m") == 0){
+        if(argc < 2)
+            return 0;
+        Options.mapfile = argv[1];
+        used = 2;
+    }else if(strcmp(argv[0], "--emit") == 0){
+        // format=file, argv is forwarded as is so the string is not split
+        char *eq = (argc < 2) ? NULL : strchr(argv[1], '=');
+        if( !eq || (eq[1] == '\0') || (Options.emits == EMIT_MAX) )
+            return 0;
+        size_t len = eq - argv[1];
+        size_t idx;
+        for(idx=0; idx<sizeof(EmitFormats)/sizeof(EmitFormats[0]); idx++)
+            if( (strlen(EmitFormats[idx].name) == len) && (strncmp(argv[1], EmitFormats[idx].name, len) == 0) )
+                break;
+        if(idx == sizeof(EmitFormats)/sizeof(EmitFormats[0]))
+            return 0;
+        Options.emit[Options.emits].format = EmitFormats[idx].format;
+        Options.emit[Options.emits].path = eq+1;
+        Options.emits++;
+        used = 2;
+    }else
+        return 0;
+
+    if(OptionCount+used > OPTIONS_MAX){
+        errcode = ERR_OPTOVERFLOW;
+        InternalError("Error: ");
+        exit(EXIT_FAILURE);
+    }
+    int idx;
+    for(idx=0; idx<used; idx++)
+        OptionArgs[OptionCount++] = argv[idx];
+
+    return used;
+}
+
+/* Stages receive their positional arguments first and the options after
+   them, argv must point at the first option */
+void DecodeOptions(int argc, char **argv)
+{
+    int idx = 0;
+    while(idx < argc){
+        int used = DecodeOption(argc-idx, argv+idx);
+        if(used == 0){
+            errcode = ERR_UNKNOWNOPT;
+            InternalError("Error: %s: ", argv[idx]);
+            exit(EXIT_FAILURE);
+        }
+        idx += used;
+    }
+}
+
+/* Builds the argument vector of the next stage: the program name, the NULL
+   terminated positional arguments and then every accepted option */
+char **ComposeArguments(char *prog, ...)
+{
+    va_list ArgList;
+    size_t count = 1;
+
+    va_start(ArgList, prog);
+    while(va_arg(ArgList, char*) != NULL)
+        count++;
+    va_end(ArgList);
+
+    char **argv = malloc( (count+OptionCount+1)*sizeof(char*) );
+    if(!argv){
+        ExternalError("Failed to allocate arguments: ");
+        exit(EXIT_FAILURE);
+    }
+
+    size_t idx = 0;
+    argv[idx++] = strdup(prog);
+    va_start(ArgList, prog);
+    char *arg;
+    while((arg = va_arg(ArgList, char*)) != NULL)
+        argv[idx++] = strdup(arg);
+    va_end(ArgList);
+
+    SCounter_t opt;
+    for(opt=0; opt<OptionCount; opt++)
+        argv[idx++] = OptionArgs[opt];
+    argv[idx] = NULL;
+
+    return argv;
+}
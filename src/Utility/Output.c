@@ -0,0 +1,609 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#define _GNU_SOURCE                 // sync_file_range()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Assembler.h"
+#include "../../include/Options.h"
+#include "../../include/Object.h"
+
+#define FILL_CHUNK 65536            // Pattern buffer for stdio fills
+
+/* Output Variables */
+FILE *fdest;                        // Destination file when it is not mapped
+uint8_t *Image;                     // Mapped destination file, NULL if not mapped
+size_t ImageSize;                   // Size of the image computed by pass 1
+size_t OutCursor;                   // Image offset of the next byte
+size_t OutEnd;                      // Largest offset reached, holes included
+size_t OutputFlushed;               // Offset written back so far in streaming mode
+LCounter_t ImageBase;               // Address of the first byte, loc of the first segment
+size_t OutOrigin;                   // File offset of the image, past an executable header
+InsnBytes_t LastInsn;               // Last instruction written, the relocations are placed at its fields
+Sink_t Sinks[SINKS_MAX];            // Files formatted from the bytes as they are written
+SCounter_t SinkCount;
+
+/* Tables */
+extern Segment_t *SegmentTable;
+extern size_t stsize;
+extern size_t CurrentSegment;
+
+/* Options */
+extern Options_t Options;
+
+/* Error Functions/Variables */
+extern LCounter_t LN;
+extern uint8_t errcode;
+extern void PrintError(char *color, char *format, ...);
+extern void InternalError(char *format, ...);
+extern void ExternalError(char *format, ...);
+extern void ExitSafely(int retcode);
+
+/* Sinks */
+extern Boolean_t OpenRecordSink(const char *path, uint8_t format, LCounter_t start, LCounter_t end);
+extern Boolean_t OpenImageSink(const char *path, LCounter_t base, size_t size);
+extern Boolean_t OpenChecksumSink(const char *path, const char *image, LCounter_t base, size_t size);
+
+/* Executable Formats */
+extern size_t GetMZHeaderSize(void);
+extern void BuildMZHeader(uint8_t *buf, size_t hdrsize, size_t filesize);
+extern size_t GetObjectHeaderSize(void);
+extern void BuildObjectHeader(uint8_t *buf, size_t tables);
+extern Boolean_t WriteObjectTables(FILE *file, size_t origin);
+
+/* Function Declerations */
+size_t GetImageSize(void);
+Boolean_t OpenOutput(const char *path);
+void CloseOutput(void);
+void BeginSegment(size_t seg);
+void SeekOutput(size_t offset);
+void WriteBytes2File(const uint8_t *buf, size_t len);
+Boolean_t EmitInsn(const InsnBytes_t *insn);
+void FillPattern(const uint8_t *pat, size_t len, LCounter_t count);
+void CopyFile2Output(int fd, off_t offset, size_t len);
+void IncludeBinary(char *path, long int offset, long int length);
+void FlushOutput(void);
+Sink_t *AddSink(const char *path, const char *mode);
+static void OpenSinks(const char *image);
+static void CloseSinks(void);
+static void FeedSinks(LCounter_t addr, const uint8_t *buf, size_t len);
+static void FeedFile(int fd, off_t offset, size_t len);
+static void StoreBytes(const uint8_t *buf, size_t len);
+static uint8_t *BuildChunk(const uint8_t *pat, size_t len, size_t total, size_t *size);
+static void WriteHeader(void);
+static void OutputOverflow(void);
+
+
+
+/* Function Definitions */
+
+/* Segments are laid out one after another from the location of the first
+   one, so the image ends where the last segment ends */
+size_t GetImageSize(void)
+{
+    if(stsize == 0)
+        return 0;
+
+    size_t last = stsize-1;
+    return (SegmentTable[last].loc - SegmentTable[0].loc) + SegmentTable[last].size;
+}
+
+/* Regular files are sized up front and mapped, the encoders then write at
+   the offset of their segment. Pipes, terminals and the streaming mode
+   use buffered stdio and must be written in order. Intel HEX and
+   S-records are sinks formatted from the bytes as they are written, with
+   no image at all. MZ executables and objects reserve their header in
+   front of the image */
+Boolean_t OpenOutput(const char *path)
+{
+    struct stat st;
+
+    Image = NULL;
+    fdest = NULL;
+    if(Options.format == FORMAT_MZ)
+        OutOrigin = GetMZHeaderSize();
+    else if(Options.format == FORMAT_OBJ)
+        OutOrigin = GetObjectHeaderSize();
+    else
+        OutOrigin = 0;
+    ImageSize = OutOrigin + GetImageSize();
+    OutCursor = OutOrigin;
+    OutEnd = OutOrigin;
+    OutputFlushed = 0;
+    ImageBase = (stsize > 0) ? SegmentTable[0].loc : 0;
+
+    if( (Options.format == FORMAT_IHEX) || (Options.format == FORMAT_SREC) ){
+        if(OpenRecordSink(path, Options.format, ImageBase, ImageBase + ImageSize) == FALSE)
+            return FALSE;
+        OpenSinks(path);
+        return TRUE;
+    }
+    OpenSinks(path);
+
+    fdest = fopen(path, "w+b");        // Shared mappings need a readable descriptor
+    if(!fdest)
+        return FALSE;
+
+    int fd = fileno(fdest);
+    if( (OutOrigin > 0) && (fseeko(fdest, OutOrigin, SEEK_SET) < 0) ){
+        ExternalError("The header needs a seekable destination file: ");
+        return FALSE;
+    }
+    if( (Options.stream == SET) || (fstat(fd, &st) < 0) || !S_ISREG(st.st_mode) || (ImageSize == 0) )
+        return TRUE;
+
+    if(ftruncate(fd, ImageSize) < 0)
+        return TRUE;
+
+    void *map = mmap(NULL, ImageSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(map == MAP_FAILED){
+        ftruncate(fd, 0);
+        return TRUE;
+    }
+
+    Image = map;
+    return TRUE;
+}
+
+void CloseOutput(void)
+{
+    if( (OutOrigin > 0) && fdest )
+        WriteHeader();
+
+    if(Image){
+        munmap(Image, ImageSize);
+        Image = NULL;
+    }else if(fdest){
+        // A trailing zero fill was skipped by seeking, give it its size
+        struct stat st;
+        size_t end = (OutEnd > ImageSize) ? OutEnd : ImageSize;
+        fflush(fdest);
+        if( (fstat(fileno(fdest), &st) == 0) && S_ISREG(st.st_mode) && (st.st_size < (off_t) end) )
+            if(ftruncate(fileno(fdest), end) < 0)
+                ExternalError("Failed to size destination file: ");
+        if(Options.stream == SET)
+            FlushOutput();
+    }
+
+    // Object tables follow the image, they are complete only now
+    if( fdest && (Options.format == FORMAT_OBJ) ){
+        fflush(fdest);
+        if( (fseeko(fdest, OBJ_TABLES(ImageSize), SEEK_SET) < 0) || (WriteObjectTables(fdest, OutOrigin) == FALSE) ){
+            ExternalError("Failed to write object tables: ");
+            ExitSafely(EXIT_FAILURE);
+        }
+    }
+
+    if(fdest){
+        fclose(fdest);
+        fdest = NULL;
+    }
+    CloseSinks();
+}
+
+// Called by the parser when the body of a segment starts
+void BeginSegment(size_t seg)
+{
+    if(seg >= stsize)
+        return;
+    SeekOutput(OutOrigin + SegmentTable[seg].loc - SegmentTable[0].loc);
+}
+
+void SeekOutput(size_t offset)
+{
+    if(offset == OutCursor)
+        return;
+
+    if(Image){
+        if(offset > ImageSize)
+            OutputOverflow();
+    }else if(!fdest){
+        // Only sinks, they carry the address
+    }else if(fseeko(fdest, offset, SEEK_SET) < 0){
+        // Not seekable, only gaps ahead of the cursor can be filled
+        if(offset < OutCursor){
+            ExternalError("Failed to seek in destination file: ");
+            ExitSafely(EXIT_FAILURE);
+        }
+        while(OutCursor < offset){
+            putc(0, fdest);
+            OutCursor++;
+        }
+    }
+
+    OutCursor = offset;
+    if(OutCursor > OutEnd)
+        OutEnd = OutCursor;
+}
+
+void WriteBytes2File(const uint8_t *buf, size_t len)
+{
+    if(SinkCount > 0)
+        FeedSinks(ImageBase + OutCursor - OutOrigin, buf, len);
+    StoreBytes(buf, len);
+}
+
+/* Encoders hand over every instruction at once. The location counter
+   advances by the bytes written, so the two can not disagree. The sinks,
+   the listing among them, see the instruction as one run */
+Boolean_t EmitInsn(const InsnBytes_t *insn)
+{
+    SegmentTable[CurrentSegment].LC += insn->n;
+    LastInsn = *insn;
+    WriteBytes2File(insn->b, insn->n);
+    return TRUE;
+}
+
+/* Writes the pattern count times. Zeros are never written: the mapped
+   image is a freshly truncated file, which reads back zero, and a seekable
+   stdio file gets a hole by seeking over it. Other patterns are copied with
+   doubling memcpy, into the image directly or into a chunk for stdio and
+   the sinks */
+void FillPattern(const uint8_t *pat, size_t len, LCounter_t count)
+{
+    size_t total = len * (size_t) count;
+    if(total == 0)
+        return;
+
+    size_t idx;
+    Boolean_t zero = TRUE;
+    for(idx=0; idx<len; idx++)
+        if(pat[idx] != 0)
+            zero = FALSE;
+
+    uint8_t *buf = NULL;
+    size_t chunk = 0;
+    if( (zero == FALSE) && ((SinkCount > 0) || (!Image && fdest)) )
+        buf = BuildChunk(pat, len, total, &chunk);
+
+    if(SinkCount > 0){
+        LCounter_t addr = ImageBase + OutCursor - OutOrigin;
+        if(zero == TRUE)
+            FeedSinks(addr, NULL, total);
+        for(idx=0; (zero == FALSE) && (idx < total); idx+=chunk)
+            FeedSinks(addr+idx, buf, (total-idx < chunk) ? total-idx : chunk);
+    }
+
+    if(Image){
+        if(total > ImageSize - OutCursor)
+            OutputOverflow();
+        if(zero == FALSE){
+            uint8_t *dst = Image + OutCursor;
+            size_t done = len;
+            memcpy(dst, pat, len);
+            while(done < total){
+                size_t n = (done < total-done) ? done : total-done;
+                memcpy(dst+done, dst, n);
+                done += n;
+            }
+        }
+        OutCursor += total;
+        free(buf);
+        return;
+    }
+
+    if(!fdest){
+        OutCursor += total;         // Only sinks
+        free(buf);
+        return;
+    }
+    if( (zero == TRUE) && (Options.stream == NSET) ){
+        fflush(fdest);
+        if(fseeko(fdest, total, SEEK_CUR) == 0){
+            OutCursor += total;
+            if(OutCursor > OutEnd)
+                OutEnd = OutCursor;
+            return;
+        }
+    }
+
+    if(!buf)
+        buf = BuildChunk(pat, len, total, &chunk);      // Zeros into a pipe
+    while(total > 0){
+        size_t n = (total < chunk) ? total : chunk;
+        StoreBytes(buf, n);
+        total -= n;
+    }
+    free(buf);
+}
+
+/* Copies len bytes of fd from offset to the cursor. The kernel moves the
+   data with copy_file_range() into a file, which the shared mapping sees,
+   or with sendfile() into a pipe. pread() is the fallback for both */
+void CopyFile2Output(int fd, off_t offset, size_t len)
+{
+    if(Image && (len > ImageSize - OutCursor))
+        OutputOverflow();
+    if(SinkCount > 0)
+        FeedFile(fd, offset, len);
+    if(!fdest){
+        OutCursor += len;           // Only sinks
+        return;
+    }
+
+    int outfd = fileno(fdest);
+    size_t done = 0;
+    ssize_t ret = 0;
+    fflush(fdest);
+
+    if(Image){
+        loff_t in = offset, out = OutCursor;
+        while(done < len){
+            ret = copy_file_range(fd, &in, outfd, &out, len-done, 0);
+            if(ret <= 0)
+                break;
+            done += ret;
+        }
+        while(done < len){
+            ret = pread(fd, Image+OutCursor+done, len-done, offset+done);
+            if(ret <= 0)
+                break;
+            done += ret;
+        }
+    }else{
+        loff_t in = offset, out = OutCursor;
+        if(Options.stream == NSET){
+            while(done < len){
+                ret = copy_file_range(fd, &in, outfd, &out, len-done, 0);
+                if(ret <= 0)
+                    break;
+                done += ret;
+            }
+            if( (done > 0) && (fseeko(fdest, OutCursor+done, SEEK_SET) < 0) ){
+                ExternalError("Failed to seek in destination file: ");
+                ExitSafely(EXIT_FAILURE);
+            }
+        }
+        if(done == 0){
+            off_t pos = offset;
+            while(done < len){
+                ret = sendfile(outfd, fd, &pos, len-done);
+                if(ret <= 0)
+                    break;
+                done += ret;
+            }
+            fseeko(fdest, OutCursor+done, SEEK_SET);    // Resynchronize stdio, fails on pipes
+        }
+        uint8_t buf[FILL_CHUNK];
+        while(done < len){
+            size_t n = (len-done < FILL_CHUNK) ? len-done : FILL_CHUNK;
+            ret = pread(fd, buf, n, offset+done);
+            if(ret <= 0)
+                break;
+            fwrite(buf, sizeof(uint8_t), ret, fdest);
+            done += ret;
+        }
+    }
+
+    if(done < len){
+        if(ret < 0)
+            ExternalError("Line %d :: INCBIN failed to copy: ", LN);
+        else
+            PrintError(COLOR_BOLDRED, "Line %d :: INCBIN file is shorter than in pass 1!\n", LN);
+        ExitSafely(EXIT_FAILURE);
+    }
+
+    OutCursor += len;
+    if(OutCursor > OutEnd)
+        OutEnd = OutCursor;
+    if( !Image && (Options.stream == SET) && (OutCursor - OutputFlushed >= STREAM_FLUSHSIZE) )
+        FlushOutput();
+}
+
+// INCBIN, the bytes never pass through the parser
+void IncludeBinary(char *path, long int offset, long int length)
+{
+    int fd = open(path, O_RDONLY);
+    if(fd < 0){
+        ExternalError("Line %d :: INCBIN failed to open %s: ", LN, path);
+        ExitSafely(EXIT_FAILURE);
+    }
+
+    CopyFile2Output(fd, offset, length);
+    close(fd);
+}
+
+/* Starts the write back of the bytes since the last call and drops the
+   previous chunk from the page cache once it is on disk. Memory of a
+   streaming assembly does not depend on the size of the image then */
+void FlushOutput(void)
+{
+    int fd = fileno(fdest);
+    fflush(fdest);
+
+    if(OutCursor <= OutputFlushed)
+        return;
+
+    sync_file_range(fd, OutputFlushed, OutCursor - OutputFlushed, SYNC_FILE_RANGE_WRITE);
+    if(OutputFlushed >= STREAM_FLUSHSIZE){
+        off_t prev = OutputFlushed - STREAM_FLUSHSIZE;
+        sync_file_range(fd, prev, STREAM_FLUSHSIZE,
+                        SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+        posix_fadvise(fd, prev, STREAM_FLUSHSIZE, POSIX_FADV_DONTNEED);
+    }
+
+    OutputFlushed = OutCursor;
+}
+
+/* Registers a sink writing path through its own stdio buffer. The caller
+   sets its functions and state, NULL if the file can not be created */
+Sink_t *AddSink(const char *path, const char *mode)
+{
+    if(SinkCount == SINKS_MAX){
+        PrintError(COLOR_BOLDRED, "Too many output files!\n");
+        return NULL;
+    }
+    FILE *file = fopen(path, mode);
+    if(!file)
+        return NULL;
+    setvbuf(file, NULL, _IOFBF, STREAM_BUFSIZE);
+
+    Sink_t *sink = &Sinks[SinkCount++];
+    memset(sink, 0, sizeof(Sink_t));
+    sink->file = file;
+    sink->path = path;
+    return sink;
+}
+
+// Sinks of --emit, image is the name of the primary output
+static void OpenSinks(const char *image)
+{
+    LCounter_t end = ImageBase + GetImageSize();
+    SCounter_t idx;
+    for(idx=0; idx<Options.emits; idx++){
+        Emit_t *emit = &Options.emit[idx];
+        Boolean_t ret;
+        if(emit->format == FORMAT_BIN)
+            ret = OpenImageSink(emit->path, ImageBase, GetImageSize());
+        else if(emit->format == FORMAT_CRC32)
+            ret = OpenChecksumSink(emit->path, image, ImageBase, GetImageSize());
+        else
+            ret = OpenRecordSink(emit->path, emit->format, ImageBase, end);
+        if(ret == FALSE){
+            ExternalError("Failed to open %s: ", emit->path);
+            ExitSafely(EXIT_FAILURE);
+        }
+    }
+}
+
+// Every sink finishes its file, in the order they were registered
+static void CloseSinks(void)
+{
+    SCounter_t count = SinkCount;
+    SCounter_t idx;
+    SinkCount = 0;                  // Nothing is fed while closing
+    for(idx=0; idx<count; idx++){
+        Sink_t *sink = &Sinks[idx];
+        if(sink->close)
+            sink->close(sink);
+        if(fclose(sink->file) != 0)
+            ExternalError("Failed to write %s: ", sink->path);
+    }
+}
+
+static void FeedSinks(LCounter_t addr, const uint8_t *buf, size_t len)
+{
+    SCounter_t idx;
+    for(idx=0; idx<SinkCount; idx++)
+        if(Sinks[idx].write)
+            Sinks[idx].write(&Sinks[idx], addr, buf, len);
+}
+
+// INCBIN bytes for the sinks, read from the included file and not the image
+static void FeedFile(int fd, off_t offset, size_t len)
+{
+    uint8_t buf[FILL_CHUNK];
+    LCounter_t addr = ImageBase + OutCursor - OutOrigin;
+    size_t done = 0;
+    while(done < len){
+        size_t n = (len-done < FILL_CHUNK) ? len-done : FILL_CHUNK;
+        ssize_t ret = pread(fd, buf, n, offset+done);
+        if(ret <= 0){
+            if(ret < 0)
+                ExternalError("Line %d :: INCBIN failed to copy: ", LN);
+            else
+                PrintError(COLOR_BOLDRED, "Line %d :: INCBIN file is shorter than in pass 1!\n", LN);
+            ExitSafely(EXIT_FAILURE);
+        }
+        FeedSinks(addr+done, buf, ret);
+        done += ret;
+    }
+}
+
+// WriteBytes2File() without the bookkeeping of the current line
+static void StoreBytes(const uint8_t *buf, size_t len)
+{
+    if(Image){
+        if(len > ImageSize - OutCursor)
+            OutputOverflow();
+        memcpy(Image+OutCursor, buf, len);
+        OutCursor += len;
+        return;
+    }
+    if(!fdest){
+        OutCursor += len;           // Only sinks
+        return;
+    }
+
+    fwrite(buf, sizeof(uint8_t), len, fdest);
+    OutCursor += len;
+    if(OutCursor > OutEnd)
+        OutEnd = OutCursor;
+
+    if( (Options.stream == SET) && (OutCursor - OutputFlushed >= STREAM_FLUSHSIZE) )
+        FlushOutput();
+}
+
+/* A whole number of patterns, so every chunk starts with the pattern. The
+   chunk holds at most total bytes */
+static uint8_t *BuildChunk(const uint8_t *pat, size_t len, size_t total, size_t *size)
+{
+    size_t chunk = (len > FILL_CHUNK) ? len : FILL_CHUNK - (FILL_CHUNK % len);
+    if(chunk > total)
+        chunk = total;
+    uint8_t *buf = malloc(chunk);
+    if(!buf){
+        ExternalError("Failed to allocate fill buffer: ");
+        ExitSafely(EXIT_FAILURE);
+    }
+    size_t done = (len < chunk) ? len : chunk;
+    memcpy(buf, pat, done);
+    while(done < chunk){
+        size_t n = (done < chunk-done) ? done : chunk-done;
+        memcpy(buf+done, buf, n);
+        done += n;
+    }
+
+    *size = chunk;
+    return buf;
+}
+
+// The header is written last, when the relocations are known
+static void WriteHeader(void)
+{
+    uint8_t *buf = Image;
+    if(!buf){
+        buf = malloc(OutOrigin);
+        if(!buf){
+            ExternalError("Failed to allocate file header: ");
+            ExitSafely(EXIT_FAILURE);
+        }
+    }
+
+    if(Options.format == FORMAT_MZ)
+        BuildMZHeader(buf, OutOrigin, ImageSize);
+    else
+        BuildObjectHeader(buf, OBJ_TABLES(ImageSize));
+
+    if(!Image){
+        fflush(fdest);
+        if( (fseeko(fdest, 0, SEEK_SET) < 0) || (fwrite(buf, sizeof(uint8_t), OutOrigin, fdest) != OutOrigin) ){
+            ExternalError("Failed to write file header: ");
+            free(buf);
+            ExitSafely(EXIT_FAILURE);
+        }
+        fseeko(fdest, OutCursor, SEEK_SET);
+        free(buf);
+    }
+}
+
+// Pass 2 produced more bytes than pass 1 reserved for the image
+static void OutputOverflow(void)
+{
+    PrintError(COLOR_BOLDRED, "Line %d :: Output exceeds the image size computed by pass 1!\n", LN);
+    ExitSafely(EXIT_FAILURE);
+}
@@ -0,0 +1,184 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Assembler.h"
+#include "../../include/Options.h"
+
+/* Reference Variables */
+Reference_t LineRefs[LINEREF_MAX];  // Symbol references of the current line
+SCounter_t lrsize;                  // Number of references in LineRefs
+static LCounter_t LineStart;        // Location counter at the start of the line
+
+/* Tables */
+extern Segment_t *SegmentTable;
+extern size_t CurrentSegment;
+
+/* Options */
+extern Options_t Options;
+
+/* Output Variables */
+extern InsnBytes_t LastInsn;            // Last instruction written
+
+/* Error Functions/Variables */
+extern Boolean_t erroneous;
+extern LCounter_t LN;
+extern void PrintError(char *color, char *format, ...);
+
+/* Relocation Functions */
+extern Boolean_t AddSegmentFixup(MCounter_t offset);
+extern Boolean_t AddObjectRelocation(uint8_t kind, size_t target, size_t section, MCounter_t offset);
+
+/* Function Declerations */
+void ResetReferences(void);
+int8_t AddReference(uint8_t kind, size_t target, short int val);
+void PlaceReference(int8_t ref, uint8_t field);
+int8_t CombineReferences(int8_t left, int8_t right, char op, short int val);
+void ResolveReferences(Boolean_t isInst);
+static Boolean_t IsRelocated(uint8_t kind);
+static SCounter_t FieldWidth(const InsnBytes_t *insn, uint8_t start);
+
+
+
+/* Function Definitions */
+
+// Called when the body of a segment starts
+void ResetReferences(void)
+{
+    lrsize = 0;
+    LineStart = SegmentTable[CurrentSegment].LC;
+}
+
+/* Registers a symbol used by an operand and returns its index, which the
+   parser carries through the expression as the value is computed */
+int8_t AddReference(uint8_t kind, size_t target, short int val)
+{
+    if(lrsize == LINEREF_MAX){
+        if(IsRelocated(kind) == TRUE){
+            PrintError(COLOR_BOLDRED, "Line %d :: Too many relocated operands!\n", LN);
+            erroneous = TRUE;
+        }
+        return -1;
+    }
+
+    LineRefs[lrsize].kind = kind;
+    LineRefs[lrsize].field = FIELD_IMM;
+    LineRefs[lrsize].live = TRUE;
+    LineRefs[lrsize].target = target;
+    LineRefs[lrsize].val = val;
+    return lrsize++;
+}
+
+// The operand is not an immediate, ref is -1 when it names no symbol
+void PlaceReference(int8_t ref, uint8_t field)
+{
+    if(ref >= 0)
+        LineRefs[ref].field = field;
+}
+
+/* A relocated operand is a symbol plus or minus a constant. The difference
+   of two offsets in the same segment is a constant as well, and so is the
+   distance of two segments in an executable. Anything else is refused when
+   the symbol has to be relocated, and is plain arithmetic otherwise */
+int8_t CombineReferences(int8_t left, int8_t right, char op, short int val)
+{
+    if( (left < 0) && (right < 0) )
+        return -1;
+
+    if( ((op == '+') && ((left < 0) || (right < 0))) || ((op == '-') && (right < 0)) ){
+        int8_t ref = (left >= 0) ? left : right;
+        LineRefs[ref].val = val;
+        return ref;
+    }
+
+    if( (op == '-') && (left >= 0) && (LineRefs[left].kind == LineRefs[right].kind) ){
+        uint8_t kind = LineRefs[left].kind;
+        if( ((kind == REF_OFFSET) && (LineRefs[left].target == LineRefs[right].target)) ||
+            ((kind == REF_SEGMENT) && (Options.format == FORMAT_MZ)) ){
+            LineRefs[left].live = FALSE;
+            LineRefs[right].live = FALSE;
+            return -1;
+        }
+    }
+
+    if( ((left >= 0) && (IsRelocated(LineRefs[left].kind) == TRUE)) ||
+        ((right >= 0) && (IsRelocated(LineRefs[right].kind) == TRUE)) ){
+        PrintError(COLOR_BOLDRED, "Line %d :: Symbol can not be relocated through '%c'!\n", LN, op);
+        erroneous = TRUE;
+    }
+    if(left >= 0)
+        LineRefs[left].live = FALSE;
+    if(right >= 0)
+        LineRefs[right].live = FALSE;
+    return -1;
+}
+
+/* Called at the end of every line. Each relocated operand is placed at
+   the field of the instruction the encoder wrote it to. An operand
+   assembled into a byte (or sign extended) is refused */
+void ResolveReferences(Boolean_t isInst)
+{
+    LCounter_t LC = SegmentTable[CurrentSegment].LC;
+    Boolean_t whole = ( (LC - LineStart) == LastInsn.n ) ? TRUE : FALSE;     // The line is the last instruction
+    SCounter_t idx;
+
+    for(idx=lrsize; idx>0; idx--){
+        Reference_t *ref = &LineRefs[idx-1];
+        if( (ref->live == FALSE) || (IsRelocated(ref->kind) == FALSE) )
+            continue;
+        if(isInst == FALSE){
+            PrintError(COLOR_BOLDRED, "Line %d :: Symbol can not be relocated here!\n", LN);
+            erroneous = TRUE;
+            break;
+        }
+
+        uint8_t start = (ref->field == FIELD_DISP) ? LastInsn.disp : (ref->field == FIELD_SEG) ? LastInsn.seg : LastInsn.imm;
+        if( (whole == FALSE) || (start == 0) || (FieldWidth(&LastInsn, start) != 2) ){
+            PrintError(COLOR_BOLDRED, "Line %d :: Relocated operand must be a word!\n", LN);
+            erroneous = TRUE;
+            continue;
+        }
+
+        Boolean_t ret;
+        if(Options.format == FORMAT_MZ)
+            ret = AddSegmentFixup(LineStart + start);
+        else
+            ret = AddObjectRelocation(ref->kind, ref->target, CurrentSegment, LineStart + start);
+        if(ret == FALSE)
+            erroneous = TRUE;
+    }
+
+    lrsize = 0;
+    LineStart = LC;
+}
+
+// Executables only relocate segment bases, objects every symbol
+static Boolean_t IsRelocated(uint8_t kind)
+{
+    if(Options.format == FORMAT_OBJ)
+        return TRUE;
+    if( (Options.format == FORMAT_MZ) && (kind == REF_SEGMENT) )
+        return TRUE;
+    return FALSE;
+}
+
+// Bytes up to the next field of the instruction or its end
+static SCounter_t FieldWidth(const InsnBytes_t *insn, uint8_t start)
+{
+    uint8_t end = insn->n;
+    if( (insn->disp > start) && (insn->disp < end) )
+        end = insn->disp;
+    if( (insn->imm > start) && (insn->imm < end) )
+        end = insn->imm;
+    if( (insn->seg > start) && (insn->seg < end) )
+        end = insn->seg;
+    return end - start;
+}
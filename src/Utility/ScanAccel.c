@@ -0,0 +1,139 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../include/Definitions.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define SCAN_X86
+    #include <immintrin.h>
+#endif
+
+/* Function Declerations */
+const char *ScanForSet(const char *p, const char *end, const ScanSet_t *set, LCounter_t *newlines);
+void InitScanSet(ScanSet_t *set, const char *chars);
+
+static const char *ScanScalar(const char *p, const char *end, const ScanSet_t *set, LCounter_t *newlines);
+#ifdef SCAN_X86
+static const char *ScanSSE2(const char *p, const char *end, const ScanSet_t *set, LCounter_t *newlines);
+static const char *ScanAVX2(const char *p, const char *end, const ScanSet_t *set, LCounter_t *newlines);
+#endif
+
+/* Selected on the first call according to the running CPU */
+static const char *(*ScanImpl)(const char *, const char *, const ScanSet_t *, LCounter_t *) = NULL;
+
+
+
+/* Function Definitions */
+
+// Up to SCANSET_MAX stop characters, unused entries repeat the first one
+void InitScanSet(ScanSet_t *set, const char *chars)
+{
+    size_t len = strlen(chars);
+    size_t idx;
+    for(idx=0; idx<SCANSET_MAX; idx++)
+        set->chars[idx] = (uint8_t) chars[ (idx < len) ? idx : 0 ];
+}
+
+/* Returns the first byte of [p, end) inside the set, or end. The newlines
+   skipped before that position are added to *newlines */
+const char *ScanForSet(const char *p, const char *end, const ScanSet_t *set, LCounter_t *newlines)
+{
+    if(ScanImpl == NULL){
+        ScanImpl = ScanScalar;
+#ifdef SCAN_X86
+        __builtin_cpu_init();
+        if( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt") )
+            ScanImpl = ScanAVX2;
+        else if( __builtin_cpu_supports("sse2") )
+            ScanImpl = ScanSSE2;
+#endif
+    }
+
+    return ScanImpl(p, end, set, newlines);
+}
+
+static const char *ScanScalar(const char *p, const char *end, const ScanSet_t *set, LCounter_t *newlines)
+{
+    LCounter_t count = 0;
+    for(; p < end; p++){
+        uint8_t c = (uint8_t) *p;
+        if( (c == set->chars[0]) || (c == set->chars[1]) || (c == set->chars[2]) || (c == set->chars[3]) )
+            break;
+        if(c == '\n')
+            count++;
+    }
+
+    *newlines += count;
+    return p;
+}
+
+#ifdef SCAN_X86
+
+__attribute__((target("sse2")))
+static const char *ScanSSE2(const char *p, const char *end, const ScanSet_t *set, LCounter_t *newlines)
+{
+    const __m128i c0 = _mm_set1_epi8((char) set->chars[0]);
+    const __m128i c1 = _mm_set1_epi8((char) set->chars[1]);
+    const __m128i c2 = _mm_set1_epi8((char) set->chars[2]);
+    const __m128i c3 = _mm_set1_epi8((char) set->chars[3]);
+    const __m128i nl = _mm_set1_epi8('\n');
+    LCounter_t count = 0;
+
+    while(end - p >= 16){
+        __m128i v = _mm_loadu_si128((const __m128i *) p);
+        __m128i hit = _mm_or_si128( _mm_or_si128(_mm_cmpeq_epi8(v, c0), _mm_cmpeq_epi8(v, c1)),
+                                    _mm_or_si128(_mm_cmpeq_epi8(v, c2), _mm_cmpeq_epi8(v, c3)) );
+        uint32_t stop  = (uint32_t) _mm_movemask_epi8(hit);
+        uint32_t lines = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(v, nl));
+        if(stop){
+            uint32_t pos = __builtin_ctz(stop);
+            count += __builtin_popcount( lines & ((1u << pos) - 1) );
+            *newlines += count;
+            return p + pos;
+        }
+        count += __builtin_popcount(lines);
+        p += 16;
+    }
+
+    *newlines += count;
+    return ScanScalar(p, end, set, newlines);
+}
+
+__attribute__((target("avx2,popcnt")))
+static const char *ScanAVX2(const char *p, const char *end, const ScanSet_t *set, LCounter_t *newlines)
+{
+    const __m256i c0 = _mm256_set1_epi8((char) set->chars[0]);
+    const __m256i c1 = _mm256_set1_epi8((char) set->chars[1]);
+    const __m256i c2 = _mm256_set1_epi8((char) set->chars[2]);
+    const __m256i c3 = _mm256_set1_epi8((char) set->chars[3]);
+    const __m256i nl = _mm256_set1_epi8('\n');
+    LCounter_t count = 0;
+
+    while(end - p >= 32){
+        __m256i v = _mm256_loadu_si256((const __m256i *) p);
+        __m256i hit = _mm256_or_si256( _mm256_or_si256(_mm256_cmpeq_epi8(v, c0), _mm256_cmpeq_epi8(v, c1)),
+                                       _mm256_or_si256(_mm256_cmpeq_epi8(v, c2), _mm256_cmpeq_epi8(v, c3)) );
+        uint32_t stop  = (uint32_t) _mm256_movemask_epi8(hit);
+        uint32_t lines = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, nl));
+        if(stop){
+            uint32_t pos = __builtin_ctz(stop);
+            count += __builtin_popcount( lines & ((1u << pos) - 1) );
+            *newlines += count;
+            return p + pos;
+        }
+        count += __builtin_popcount(lines);
+        p += 32;
+    }
+
+    *newlines += count;
+    return ScanSSE2(p, end, set, newlines);
+}
+
+#endif
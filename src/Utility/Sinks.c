@@ -0,0 +1,183 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Assembler.h"
+
+#define CRC32_POLY 0xEDB88320u      // IEEE 802.3, reflected
+
+/* Sink Variables */
+static uint32_t CrcTable[256];
+
+/* Error Functions/Variables */
+extern Boolean_t erroneous;
+extern void PrintError(char *color, char *format, ...);
+extern void ExternalError(char *format, ...);
+
+/* Symbol Map */
+extern Boolean_t WriteSymbolMap(FILE *fmap);
+
+/* Output Functions */
+extern Sink_t *AddSink(const char *path, const char *mode);
+
+/* Function Declerations */
+Boolean_t OpenImageSink(const char *path, LCounter_t base, size_t size);
+Boolean_t OpenChecksumSink(const char *path, const char *image, LCounter_t base, size_t size);
+Boolean_t OpenSymbolMap(const char *path);
+static void WriteImage(Sink_t *sink, LCounter_t addr, const uint8_t *buf, size_t len);
+static void CloseImage(Sink_t *sink);
+static void WriteChecksum(Sink_t *sink, LCounter_t addr, const uint8_t *buf, size_t len);
+static void CloseChecksum(Sink_t *sink);
+static void CloseSymbolMap(Sink_t *sink);
+static uint32_t SumZeros(uint32_t crc, size_t len);
+
+
+
+/* Function Definitions */
+
+/* The flat image next to another primary format, such as the binary of an
+   executable without its header. It is written as it comes, seeking over
+   the gaps like the image itself */
+Boolean_t OpenImageSink(const char *path, LCounter_t base, size_t size)
+{
+    ImageSink_t *img = calloc(1, sizeof(ImageSink_t));
+    Sink_t *sink = (img) ? AddSink(path, "wb") : NULL;
+    if(!sink){
+        free(img);
+        return FALSE;
+    }
+    sink->write = WriteImage;
+    sink->close = CloseImage;
+    sink->state = img;
+    img->base = base;
+    img->size = size;
+    return TRUE;
+}
+
+/* CRC-32 of the flat image, in the format of the usual crc32 tools. The
+   image arrives in address order, segments are laid out as they appear */
+Boolean_t OpenChecksumSink(const char *path, const char *image, LCounter_t base, size_t size)
+{
+    Checksum_t *sum = calloc(1, sizeof(Checksum_t));
+    Sink_t *sink = (sum) ? AddSink(path, "w") : NULL;
+    if(!sink){
+        free(sum);
+        return FALSE;
+    }
+    sink->write = WriteChecksum;
+    sink->close = CloseChecksum;
+    sink->state = sum;
+
+    uint32_t idx, bit;
+    for(idx=0; idx<256; idx++){
+        uint32_t crc = idx;
+        for(bit=0; bit<8; bit++)
+            crc = (crc & 1) ? (crc >> 1) ^ CRC32_POLY : crc >> 1;
+        CrcTable[idx] = crc;
+    }
+
+    sum->crc = 0xFFFFFFFFu;
+    sum->next = base;
+    sum->end = base + size;
+    sum->image = image;
+    return TRUE;
+}
+
+/* The map takes no bytes, it is a sink only to be written with the other
+   files once the tables are final */
+Boolean_t OpenSymbolMap(const char *path)
+{
+    Sink_t *sink = AddSink(path, "w");
+    if(!sink)
+        return FALSE;
+    sink->close = CloseSymbolMap;
+    return TRUE;
+}
+
+static void WriteImage(Sink_t *sink, LCounter_t addr, const uint8_t *buf, size_t len)
+{
+    ImageSink_t *img = sink->state;
+    size_t offset = addr - img->base;
+
+    if(buf){
+        if( (offset != img->pos) && (fseeko(sink->file, offset, SEEK_SET) < 0) ){
+            // Not seekable, only gaps ahead can be filled
+            while(img->pos < offset){
+                putc(0, sink->file);
+                img->pos++;
+            }
+        }
+        fwrite(buf, sizeof(uint8_t), len, sink->file);
+        img->pos = offset + len;
+    }
+    if(offset + len > img->end)
+        img->end = offset + len;
+}
+
+// A trailing gap is not written, the file is given its size
+static void CloseImage(Sink_t *sink)
+{
+    ImageSink_t *img = sink->state;
+    struct stat st;
+    size_t end = (img->end > img->size) ? img->end : img->size;
+
+    fflush(sink->file);
+    if( (fstat(fileno(sink->file), &st) == 0) && S_ISREG(st.st_mode) && (st.st_size < (off_t) end) )
+        if(ftruncate(fileno(sink->file), end) < 0)
+            ExternalError("Failed to size %s: ", sink->path);
+    free(img);
+}
+
+static void WriteChecksum(Sink_t *sink, LCounter_t addr, const uint8_t *buf, size_t len)
+{
+    Checksum_t *sum = sink->state;
+    uint32_t crc = sum->crc;
+
+    if(addr > sum->next)
+        crc = SumZeros(crc, addr - sum->next);
+    if(buf){
+        size_t idx;
+        for(idx=0; idx<len; idx++)
+            crc = CrcTable[(crc ^ buf[idx]) & 0xFF] ^ (crc >> 8);
+    }else
+        crc = SumZeros(crc, len);
+
+    sum->crc = crc;
+    sum->next = addr + len;
+}
+
+static void CloseChecksum(Sink_t *sink)
+{
+    Checksum_t *sum = sink->state;
+    uint32_t crc = sum->crc;
+    if(sum->next < sum->end)
+        crc = SumZeros(crc, sum->end - sum->next);
+
+    fprintf(sink->file, "%08x  %s\n", crc ^ 0xFFFFFFFFu, sum->image);
+    free(sum);
+}
+
+// A failed assembly leaves the file empty, pass 2 removes it
+static void CloseSymbolMap(Sink_t *sink)
+{
+    if( (erroneous == FALSE) && (WriteSymbolMap(sink->file) == FALSE) )
+        ExternalError("Failed to write symbol map: ");
+}
+
+static uint32_t SumZeros(uint32_t crc, size_t len)
+{
+    while(len-- > 0)
+        crc = CrcTable[crc & 0xFF] ^ (crc >> 8);
+    return crc;
+}
@@ -0,0 +1,140 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "../../include/Definitions.h"
+
+#define SRCMAP_READCHUNK 65536      // Growth step while reading pipes
+
+/* Function Declerations */
+Boolean_t MapSourceFile(const char *path, SourceBuffer_t *src);
+void UnmapSourceFile(SourceBuffer_t *src);
+static Boolean_t ReadSourceFile(int fd, SourceBuffer_t *src);
+
+
+
+/* Function Definitions */
+
+/* Makes the whole file addressable with two trailing NUL bytes, as
+   yy_scan_buffer() requires. Regular files are mapped privately, so the
+   scanner may write its hold characters into the pages without touching
+   the file. Anything else (pipes, terminals) is read into memory. */
+Boolean_t MapSourceFile(const char *path, SourceBuffer_t *src)
+{
+    struct stat st;
+
+    src->base = NULL;
+    src->len = 0;
+    src->maplen = 0;
+    src->mapped = FALSE;
+
+    int fd = open(path, O_RDONLY);
+    if(fd < 0)
+        return FALSE;
+    if(fstat(fd, &st) < 0){
+        close(fd);
+        return FALSE;
+    }
+
+    if( !S_ISREG(st.st_mode) || (st.st_size == 0) ){
+        Boolean_t ret = ReadSourceFile(fd, src);
+        close(fd);
+        return ret;
+    }
+
+    size_t page = (size_t) sysconf(_SC_PAGESIZE);
+    size_t len = (size_t) st.st_size;
+    size_t maplen = (len + 2 + page - 1) & ~(page - 1);
+
+    // Reserve zeroed memory for the terminators, then lay the file over it.
+    // Bytes past EOF inside the last file page are zero as well.
+    char *base = mmap(NULL, maplen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(base == MAP_FAILED){
+        close(fd);
+        return FALSE;
+    }
+    if(mmap(base, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED){
+        int err = errno;
+        munmap(base, maplen);
+        close(fd);
+        errno = err;
+        return FALSE;
+    }
+    close(fd);
+
+    madvise(base, len, MADV_SEQUENTIAL);
+
+    src->base = base;
+    src->len = len;
+    src->maplen = maplen;
+    src->mapped = TRUE;
+    return TRUE;
+}
+
+void UnmapSourceFile(SourceBuffer_t *src)
+{
+    if(src->base == NULL)
+        return;
+
+    if(src->mapped == TRUE)
+        munmap(src->base, src->maplen);
+    else
+        free(src->base);
+
+    src->base = NULL;
+    src->len = 0;
+    src->maplen = 0;
+}
+
+static Boolean_t ReadSourceFile(int fd, SourceBuffer_t *src)
+{
+    size_t cap = SRCMAP_READCHUNK;
+    size_t len = 0;
+    char *buf = malloc(cap);
+    if(!buf)
+        return FALSE;
+
+    for(;;){
+        if(cap - len <= 2){
+            char *tmp = realloc(buf, cap << 1);
+            if(!tmp){
+                free(buf);
+                return FALSE;
+            }
+            buf = tmp;
+            cap <<= 1;
+        }
+
+        ssize_t ret = read(fd, buf+len, cap-len-2);
+        if(ret == 0)
+            break;
+        if(ret < 0){
+            if(errno == EINTR)
+                continue;
+            free(buf);
+            return FALSE;
+        }
+        len += (size_t) ret;
+    }
+
+    buf[len] = '\0';
+    buf[len+1] = '\0';
+
+    src->base = buf;
+    src->len = len;
+    src->maplen = cap;
+    src->mapped = FALSE;
+    return TRUE;
+}
@@ -0,0 +1,169 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Assembler.h"
+#include "../../include/Options.h"
+
+#define RADIX_BITS    8             // Address bits sorted per pass
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+
+/* Tables */
+extern Segment_t *SegmentTable;
+extern Label_t *LabelTable;
+extern size_t stsize;
+extern size_t ltsize;
+
+/* Error Functions/Variables */
+extern void ExternalError(char *format, ...);
+extern size_t CheckSegmentExistence(char *sname);
+
+/* Function Declerations */
+Boolean_t WriteSymbolMap(FILE *fmap);
+void WriteSegmentMap(FILE *fmap);
+Boolean_t WriteLabelMap(FILE *fmap);
+LCounter_t GetLayoutSize(void);
+Boolean_t WalkLabelsByAddress(FILE *out, void (*visit)(FILE *out, size_t nth, const Label_t *label, const Segment_t *seg, LCounter_t addr, LCounter_t size));
+static void PutLabelMapLine(FILE *fmap, size_t nth, const Label_t *label, const Segment_t *seg, LCounter_t addr, LCounter_t size);
+static size_t *SortLabelsByAddress(LCounter_t *addr, size_t *segment);
+static void RadixSort(const LCounter_t *key, size_t *order, size_t *tmp, size_t count);
+
+
+
+/* Function Definitions */
+
+// Segments in layout order, then labels by address
+Boolean_t WriteSymbolMap(FILE *fmap)
+{
+    WriteSegmentMap(fmap);
+    fprintf(fmap, "\n");
+    return WriteLabelMap(fmap);
+}
+
+void WriteSegmentMap(FILE *fmap)
+{
+    size_t idx;
+    fprintf(fmap, "Segments\n");
+    fprintf(fmap, "%10s  %8s  %s\n", "Address", "Size", "Name");
+    for(idx=0; idx<stsize; idx++)
+        fprintf(fmap, "  %08X  %08X  %s\n", SegmentTable[idx].loc, SegmentTable[idx].size, SegmentTable[idx].name);
+}
+
+Boolean_t WriteLabelMap(FILE *fmap)
+{
+    fprintf(fmap, "Labels\n");
+    fprintf(fmap, "%10s  %6s  %8s  %-16s  %s\n", "Address", "Offset", "Size", "Segment", "Name");
+    if(WalkLabelsByAddress(fmap, PutLabelMapLine) == FALSE)
+        return FALSE;
+    return (ferror(fmap)) ? FALSE : TRUE;
+}
+
+// Bytes from the first segment to the end of the last, as the image is laid out
+LCounter_t GetLayoutSize(void)
+{
+    if(stsize == 0)
+        return 0;
+    return (SegmentTable[stsize-1].loc - SegmentTable[0].loc) + SegmentTable[stsize-1].size;
+}
+
+/* Calls visit for every label in address order, nth counts from 0. The
+   size of a label runs up to the next label or the end of its segment,
+   which is the size of the code or data it names */
+Boolean_t WalkLabelsByAddress(FILE *out, void (*visit)(FILE *out, size_t nth, const Label_t *label, const Segment_t *seg, LCounter_t addr, LCounter_t size))
+{
+    LCounter_t *addr = malloc( (ltsize+1)*sizeof(LCounter_t) );
+    size_t *segment = malloc( (ltsize+1)*sizeof(size_t) );
+    size_t *order = (addr && segment) ? SortLabelsByAddress(addr, segment) : NULL;
+    if(!order){
+        free(addr);
+        free(segment);
+        return FALSE;
+    }
+
+    size_t idx;
+    for(idx=0; idx<ltsize; idx++){
+        size_t lab = order[idx];
+        const Segment_t *seg = &SegmentTable[segment[lab]];
+        LCounter_t end = seg->loc + seg->size;
+        if( (idx+1 < ltsize) && (addr[order[idx+1]] < end) )
+            end = addr[order[idx+1]];
+        visit(out, idx, &LabelTable[lab], seg, addr[lab], end - addr[lab]);
+    }
+
+    free(order);
+    free(addr);
+    free(segment);
+    return TRUE;
+}
+
+static void PutLabelMapLine(FILE *fmap, size_t nth, const Label_t *label, const Segment_t *seg, LCounter_t addr, LCounter_t size)
+{
+    fprintf(fmap, "  %08X    %04X  %08X  %-16s  %s\n", addr, label->loc, size, seg->name, label->name);
+}
+
+/* Fills the absolute address and the segment of every label and returns
+   the label indices in address order, NULL if out of memory. Labels are
+   registered segment after segment, so the segment lookup is only done
+   when the name changes */
+static size_t *SortLabelsByAddress(LCounter_t *addr, size_t *segment)
+{
+    size_t *order = malloc( (ltsize+1)*sizeof(size_t) );
+    size_t *tmp = malloc( (ltsize+1)*sizeof(size_t) );
+    if( !order || !tmp ){
+        ExternalError("Failed to allocate symbol map: ");
+        free(order);
+        free(tmp);
+        return NULL;
+    }
+
+    size_t idx, seg = 0;
+    for(idx=0; idx<ltsize; idx++){
+        if( (seg >= stsize) || (strcmp(SegmentTable[seg].name, LabelTable[idx].segname) != 0) )
+            seg = CheckSegmentExistence(LabelTable[idx].segname);
+        if(seg == (size_t) -1)
+            seg = 0;                // Can not happen, pass 1 registered it
+        segment[idx] = seg;
+        addr[idx] = SegmentTable[seg].loc + LabelTable[idx].loc;
+        order[idx] = idx;
+    }
+
+    RadixSort(addr, order, tmp, ltsize);
+    free(tmp);
+    return order;
+}
+
+/* Least significant digit first, so labels at the same address keep the
+   order they were defined in. A digit every key shares needs no pass,
+   which skips the upper half of 16 bit addresses */
+static void RadixSort(const LCounter_t *key, size_t *order, size_t *tmp, size_t count)
+{
+    size_t hist[RADIX_BUCKETS];
+    SCounter_t shift;
+    size_t idx;
+
+    for(shift=0; shift<32; shift+=RADIX_BITS){
+        memset(hist, 0, sizeof(hist));
+        for(idx=0; idx<count; idx++)
+            hist[(key[order[idx]] >> shift) & (RADIX_BUCKETS-1)]++;
+        if( (count == 0) || (hist[(key[order[0]] >> shift) & (RADIX_BUCKETS-1)] == count) )
+            continue;
+
+        size_t sum = 0, bucket;
+        for(bucket=0; bucket<RADIX_BUCKETS; bucket++){
+            size_t n = hist[bucket];
+            hist[bucket] = sum;
+            sum += n;
+        }
+        for(idx=0; idx<count; idx++)
+            tmp[hist[(key[order[idx]] >> shift) & (RADIX_BUCKETS-1)]++] = order[idx];
+        memcpy(order, tmp, count*sizeof(size_t));
+    }
+}
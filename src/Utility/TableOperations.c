@@ -19,7 +19,7 @@ extern Flag_t isSOP;                     // Is segment is overwritten
 extern Flag_t isORG;                     // Is ORG directive used
 extern uint8_t SOP;
 extern LCounter_t LN;
-extern MCounter_t LC;
+extern LCounter_t LC;
 
 /* Tables */
 extern Segment_t *SegmentTable;
@@ -62,12 +62,14 @@ Boolean_t RegisterSegment(char *str)
         strcpy(SegmentTable[stsize].name, str); // Segment name
         SegmentTable[stsize].LC = 0;    // Local LC
         SegmentTable[stsize].loc = LC;  // Global LC
+        SegmentTable[stsize].size = 0;  // Set by pass 2 from the symbol table
         stsize++;
     }else{
         SegmentTable = realloc(SegmentTable, (stsize+1)*sizeof(Segment_t));
         strcpy(SegmentTable[stsize].name, str); // Segment name
         SegmentTable[stsize].LC = 0;    // Local LC
         SegmentTable[stsize].loc = LC;  // Global LC
+        SegmentTable[stsize].size = 0;  // Set by pass 2 from the symbol table
         stsize++;
     }
 
@@ -88,7 +90,7 @@ Boolean_t RegisterLabel(char *str)
         LabelTable = malloc(sizeof(Label_t));
         strcpy(LabelTable[ltsize].name, str);                       // Label name
         strcpy(LabelTable[ltsize].segname, SegmentTable[stsize-1].name); // Segment Name
-        SegmentTable[ltsize].loc = SegmentTable[stsize-1].LC;         // Location within Segment
+        LabelTable[ltsize].loc = SegmentTable[stsize-1].LC;         // Location within Segment
         ltsize++;
     }else{
         LabelTable = realloc(LabelTable, (ltsize+1)*sizeof(Label_t));
@@ -109,7 +111,7 @@ size_t CheckSegmentExistence(char *sname)
     
     size_t ctr;
     for(ctr=0; ctr<stsize; ctr++){
-        if( strcmp(SegmentTable[stsize].name, sname) == 0 ){
+        if( strcmp(SegmentTable[ctr].name, sname) == 0 ){
             return ctr;
         }
     }
@@ -0,0 +1,476 @@
+/*#=========================================================================###
+##                                                                           ##
+##        Author:  Furkan Çetinkaya <furkan.cetinkaya@outlook.com.tr>        ##
+##                                                                           ##
+###=========================================================================#*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include "../../include/Definitions.h"
+#include "../../include/Errors.h"
+#include "../../include/Tokens.h"
+
+#define TOKBUF_INITCAP  65536       // Recorded token bytes, grows by doubling
+#define STRBUF_INITCAP  4096        // Recorded string bytes
+#define STRTAB_INITCAP  256         // Interned strings, a power of two
+#define VARINT_MAX      10          // Bytes of a 64 bit varint
+
+/* Token Variables */
+Flag_t TokenInput;                  // The source is a tokenized file
+Flag_t TokenOutput;                 // --emit-tokens, scanned tokens are recorded
+static TokReader_t Reader;
+
+/* Recorder Variables */
+static uint8_t *TokBuf;
+static size_t toklen, tokcap;
+static char *StrBuf;                // String table as it will be written
+static size_t strsize, strcap;
+static uint32_t *StrStart;          // Offset of every string in StrBuf
+static uint32_t *StrSlots;          // Open addressing, string index + 1
+static uint32_t nstrings, strslots;
+static LCounter_t PendingLines;     // Newlines not written yet
+static int TokShmId = -1;           // Record shared with pass 2
+
+/* Error Functions/Variables */
+extern LCounter_t LN;
+extern void PrintError(char *color, char *format, ...);
+extern void ExternalError(char *format, ...);
+extern void ExitSafely(int retcode);
+
+/* Source Mapping */
+extern Boolean_t MapSourceFile(const char *path, SourceBuffer_t *src);
+extern void UnmapSourceFile(SourceBuffer_t *src);
+
+/* Function Declerations */
+Boolean_t IsTokenFile(const char *path);
+Boolean_t OpenTokenFile(const char *path);
+int ReadToken(long int *num, char **str);
+void CloseTokenFile(void);
+Boolean_t StartTokenRecord(void);
+void RecordToken(int code, long int num, const char *str);
+Boolean_t WriteTokenFile(const char *src);
+size_t ShareTokenRecord(const char *path);
+void ReleaseTokenShare(void);
+Boolean_t AttachTokenRecord(const char *path, size_t size);
+void EndTokenRecord(void);
+static Boolean_t LoadTokens(const char *name, char *base, size_t len);
+static void MakeTokenHeader(TokHeader_t *hdr);
+static uint64_t GetVarint(void);
+static Boolean_t PutVarint(uint64_t val);
+static Boolean_t PutBytes(const void *buf, size_t len);
+static uint32_t InternString(const char *str);
+static Boolean_t GrowStringSlots(void);
+static LCounter_t HashString(const char *str);
+
+
+
+/* Function Definitions */
+
+Boolean_t IsTokenFile(const char *path)
+{
+    size_t len = strlen(path);
+    size_t ext = strlen(TOKFILE_EXT);
+    return ( (len > ext) && (strcmp(path+len-ext, TOKFILE_EXT) == 0) ) ? TRUE : FALSE;
+}
+
+/* Strings are returned in place, the mapping is private so the parser may
+   keep and change them */
+Boolean_t OpenTokenFile(const char *path)
+{
+    if(MapSourceFile(path, &Reader.map) == FALSE)
+        return FALSE;
+    return LoadTokens(path, Reader.map.base, Reader.map.len);
+}
+
+/* Next token code with its value, TK_END after the last one. A run of
+   newlines is returned one TK_NL at a time, the parser counts lines */
+int ReadToken(long int *num, char **str)
+{
+    if(Reader.lines > 0){
+        Reader.lines--;
+        return TK_NL;
+    }
+    if(Reader.pos >= Reader.end)
+        return TK_END;
+
+    uint64_t code = GetVarint();
+    uint64_t val;
+    switch(code){
+        case TK_NL:
+            val = GetVarint();
+            if(val == 0)
+                break;
+            Reader.lines = val-1;
+            return TK_NL;
+        case TK_NUMBER:
+            val = GetVarint();
+            *num = (long int) (val >> 1) ^ -(long int) (val & 1);
+            return TK_NUMBER;
+        case TK_SEGNAME:
+        case TK_LABEL:
+        case TK_STRCONST:
+            val = GetVarint();
+            if(val >= Reader.nstrings)
+                break;
+            *str = Reader.strings[val];
+            return code;
+        case TK_BADCHAR:
+            *num = GetVarint();
+            return TK_BADCHAR;
+        case TK_ORG:
+        case TK_SEGMENT:
+        case TK_HERE:
+            return code;
+        default:
+            if( (code >= TK_KEYWORD) ? (code < TOKEN_CODES) : (code && strchr(TOKEN_PUNCT, (int) code) != NULL) )
+                return code;
+            break;
+    }
+
+    PrintError(COLOR_BOLDRED, "Line %d :: Tokenized source is corrupt!\n", LN);
+    ExitSafely(EXIT_FAILURE);
+    return TK_END;
+}
+
+void CloseTokenFile(void)
+{
+    free(Reader.strings);
+    Reader.strings = NULL;
+    if(Reader.shm){
+        shmdt(Reader.shm);
+        Reader.shm = NULL;
+    }
+    UnmapSourceFile(&Reader.map);
+    TokenInput = NSET;
+}
+
+Boolean_t StartTokenRecord(void)
+{
+    TokBuf = malloc(TOKBUF_INITCAP);
+    StrBuf = malloc(STRBUF_INITCAP);
+    StrStart = malloc(STRTAB_INITCAP*sizeof(uint32_t));
+    StrSlots = calloc(STRTAB_INITCAP, sizeof(uint32_t));
+    if( !TokBuf || !StrBuf || !StrStart || !StrSlots ){
+        ExternalError("Failed to allocate token record: ");
+        return FALSE;
+    }
+    tokcap = TOKBUF_INITCAP;
+    strcap = STRBUF_INITCAP;
+    strslots = STRTAB_INITCAP;
+    TokenOutput = SET;
+    return TRUE;
+}
+
+// Values are ignored for the codes that have none
+void RecordToken(int code, long int num, const char *str)
+{
+    if(TokenOutput == NSET)
+        return;
+    if(code == TK_NL){
+        PendingLines++;
+        return;
+    }
+
+    Boolean_t ret = TRUE;
+    if(PendingLines > 0){
+        ret = PutVarint(TK_NL) && PutVarint(PendingLines);
+        PendingLines = 0;
+    }
+    ret = ret && PutVarint(code);
+    switch(code){
+        case TK_NUMBER:
+            ret = ret && PutVarint( ((uint64_t) num << 1) ^ (uint64_t) (num >> (8*sizeof(long int)-1)) );
+            break;
+        case TK_SEGNAME:
+        case TK_LABEL:
+        case TK_STRCONST:{
+            uint32_t idx = InternString(str);
+            ret = ret && (idx != (uint32_t) -1) && PutVarint(idx);
+            break;
+        }
+        case TK_BADCHAR:
+            ret = ret && PutVarint((uint8_t) num);
+            break;
+    }
+
+    if(ret == FALSE){
+        ExternalError("Failed to allocate token record: ");
+        TokenOutput = NSET;
+    }
+}
+
+/* The file is named after the source, src.qsm is written to src.qsmb */
+Boolean_t WriteTokenFile(const char *src)
+{
+    if(TokenOutput == NSET)
+        return FALSE;
+
+    const char *dot = strrchr(src, '.');
+    size_t base = (dot && !strchr(dot, '/')) ? (size_t) (dot - src) : strlen(src);
+    char *path = malloc(base + strlen(TOKFILE_EXT) + 1);
+    if(!path){
+        ExternalError("Failed to write tokenized source: ");
+        return FALSE;
+    }
+    memcpy(path, src, base);
+    strcpy(path+base, TOKFILE_EXT);
+
+    FILE *ftok = fopen(path, "wb");
+    if(!ftok){
+        ExternalError("Failed to write tokenized source: ");
+        free(path);
+        return FALSE;
+    }
+
+    TokHeader_t hdr;
+    MakeTokenHeader(&hdr);
+    fwrite(&hdr, sizeof(TokHeader_t), 1, ftok);
+    fwrite(StrBuf, sizeof(char), strsize, ftok);
+    fwrite(TokBuf, sizeof(uint8_t), toklen, ftok);
+
+    Boolean_t ret = (ferror(ftok)) ? FALSE : TRUE;
+    if( (fclose(ftok) != 0) || (ret == FALSE) ){
+        ExternalError("Failed to write tokenized source: ");
+        remove(path);
+        ret = FALSE;
+    }
+
+    free(path);
+    return ret;
+}
+
+/* Pass 2 replays the record of pass 1 instead of scanning the source once
+   more. The record is copied into a segment keyed like the symbol table,
+   its size tells pass 2 to attach it. Returns 0 if there is no record or
+   it could not be shared, pass 2 scans the source then */
+size_t ShareTokenRecord(const char *path)
+{
+    if(TokenOutput == NSET)
+        return 0;
+
+    TokHeader_t hdr;
+    MakeTokenHeader(&hdr);
+    size_t size = sizeof(TokHeader_t) + strsize + toklen;
+    key_t key = ftok(path, 'T');
+    if( (key == -1) || ((TokShmId = shmget(key, size, IPC_CREAT | 0644)) == -1) )
+        return 0;
+    char *shm = shmat(TokShmId, NULL, 0);
+    if(shm == (char *) -1){
+        ReleaseTokenShare();
+        return 0;
+    }
+
+    memcpy(shm, &hdr, sizeof(TokHeader_t));
+    memcpy(shm + sizeof(TokHeader_t), StrBuf, strsize);
+    memcpy(shm + sizeof(TokHeader_t) + strsize, TokBuf, toklen);
+    shmdt(shm);
+    EndTokenRecord();               // Pass 2 reads the segment
+    return size;
+}
+
+// Once pass 2 has exited
+void ReleaseTokenShare(void)
+{
+    if(TokShmId != -1)
+        shmctl(TokShmId, IPC_RMID, NULL);
+    TokShmId = -1;
+}
+
+Boolean_t AttachTokenRecord(const char *path, size_t size)
+{
+    key_t key = ftok(path, 'T');
+    int shmid = (key == -1) ? -1 : shmget(key, size, 0);
+    if(shmid == -1)
+        return FALSE;
+    Reader.shm = shmat(shmid, NULL, 0);
+    if(Reader.shm == (char *) -1){
+        Reader.shm = NULL;
+        return FALSE;
+    }
+    return LoadTokens(path, Reader.shm, size);
+}
+
+void EndTokenRecord(void)
+{
+    free(TokBuf);
+    free(StrBuf);
+    free(StrStart);
+    free(StrSlots);
+    TokBuf = NULL;
+    StrBuf = NULL;
+    StrStart = NULL;
+    StrSlots = NULL;
+    TokenOutput = NSET;
+}
+
+/* Checks that every table lies inside the len bytes at base and indexes
+   the strings. Closes the source if it is not valid */
+static Boolean_t LoadTokens(const char *name, char *base, size_t len)
+{
+    TokHeader_t hdr;
+    if(len >= sizeof(TokHeader_t))
+        memcpy(&hdr, base, sizeof(TokHeader_t));
+    if( (len < sizeof(TokHeader_t)) || (memcmp(hdr.magic, TOKFILE_MAGIC, 4) != 0) ||
+        (hdr.version != TOKFILE_VERSION) || (hdr.keywords != KEYWORDS) ||
+        ((uint64_t) sizeof(TokHeader_t) + hdr.strsize + hdr.toksize != len) ){
+        PrintError(COLOR_BOLDRED, "%s is not a tokenized source of this assembler!\n", name);
+        CloseTokenFile();
+        return FALSE;
+    }
+
+    char *str = base + sizeof(TokHeader_t);
+    char *strend = str + hdr.strsize;
+    Reader.strings = malloc( (hdr.nstrings+1)*sizeof(char*) );
+    if(!Reader.strings){
+        CloseTokenFile();
+        return FALSE;
+    }
+    uint32_t idx;
+    for(idx=0; idx<hdr.nstrings; idx++){
+        char *nul = (str < strend) ? memchr(str, '\0', strend-str) : NULL;
+        if(!nul){
+            PrintError(COLOR_BOLDRED, "%s is corrupt!\n", name);
+            CloseTokenFile();
+            return FALSE;
+        }
+        Reader.strings[idx] = str;
+        str = nul+1;
+    }
+
+    Reader.nstrings = hdr.nstrings;
+    Reader.pos = (const uint8_t *) strend;
+    Reader.end = (const uint8_t *) base + len;
+    Reader.lines = 0;
+    TokenInput = SET;
+    return TRUE;
+}
+
+// Writes the newlines still pending, the header describes the whole record
+static void MakeTokenHeader(TokHeader_t *hdr)
+{
+    if(PendingLines > 0){
+        PutVarint(TK_NL);
+        PutVarint(PendingLines);
+        PendingLines = 0;
+    }
+    memset(hdr, 0, sizeof(TokHeader_t));
+    memcpy(hdr->magic, TOKFILE_MAGIC, 4);
+    hdr->version = TOKFILE_VERSION;
+    hdr->keywords = KEYWORDS;
+    hdr->nstrings = nstrings;
+    hdr->strsize = strsize;
+    hdr->toksize = toklen;
+}
+
+// Little endian base 128, the file was checked to end with a complete one
+static uint64_t GetVarint(void)
+{
+    uint64_t val = 0;
+    SCounter_t shift = 0;
+    while( (Reader.pos < Reader.end) && (shift < 7*VARINT_MAX) ){
+        uint8_t byte = *Reader.pos++;
+        val |= (uint64_t) (byte & 0x7F) << shift;
+        if( (byte & 0x80) == 0 )
+            return val;
+        shift += 7;
+    }
+    return (uint64_t) -1;           // Truncated, no code or index is that large
+}
+
+static Boolean_t PutVarint(uint64_t val)
+{
+    uint8_t buf[VARINT_MAX];
+    size_t len = 0;
+    do{
+        buf[len] = val & 0x7F;
+        val >>= 7;
+        if(val)
+            buf[len] |= 0x80;
+        len++;
+    }while(val);
+    return PutBytes(buf, len);
+}
+
+static Boolean_t PutBytes(const void *buf, size_t len)
+{
+    if(toklen + len > tokcap){
+        uint8_t *tmp = realloc(TokBuf, tokcap << 1);
+        if(!tmp)
+            return FALSE;
+        TokBuf = tmp;
+        tokcap <<= 1;
+    }
+    memcpy(TokBuf+toklen, buf, len);
+    toklen += len;
+    return TRUE;
+}
+
+// Index of str in the string table, added by its first use
+static uint32_t InternString(const char *str)
+{
+    LCounter_t slot = HashString(str) & (strslots-1);
+    while(StrSlots[slot] != 0){
+        if(strcmp(StrBuf + StrStart[StrSlots[slot]-1], str) == 0)
+            return StrSlots[slot]-1;
+        slot = (slot+1) & (strslots-1);
+    }
+
+    size_t len = strlen(str) + 1;
+    while(strsize + len > strcap){
+        char *tmp = realloc(StrBuf, strcap << 1);
+        if(!tmp)
+            return (uint32_t) -1;
+        StrBuf = tmp;
+        strcap <<= 1;
+    }
+    memcpy(StrBuf+strsize, str, len);
+    StrStart[nstrings] = strsize;
+    StrSlots[slot] = ++nstrings;
+    strsize += len;
+
+    if( (nstrings > (strslots >> 1)) && (GrowStringSlots() == FALSE) )
+        return (uint32_t) -1;
+    return nstrings-1;
+}
+
+// Keeps the load factor below 1/2, StrStart grows with the slots
+static Boolean_t GrowStringSlots(void)
+{
+    uint32_t newslots = strslots << 1;
+    uint32_t *slots = calloc(newslots, sizeof(uint32_t));
+    uint32_t *start = realloc(StrStart, newslots*sizeof(uint32_t));
+    if( !slots || !start ){
+        free(slots);
+        if(start)
+            StrStart = start;
+        return FALSE;
+    }
+    StrStart = start;
+
+    uint32_t idx;
+    for(idx=0; idx<nstrings; idx++){
+        LCounter_t slot = HashString(StrBuf + StrStart[idx]) & (newslots-1);
+        while(slots[slot] != 0)
+            slot = (slot+1) & (newslots-1);
+        slots[slot] = idx+1;
+    }
+    free(StrSlots);
+    StrSlots = slots;
+    strslots = newslots;
+    return TRUE;
+}
+
+static LCounter_t HashString(const char *str)
+{
+    LCounter_t hash = 2166136261u;
+    while(*str){
+        hash ^= (uint8_t) *str++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
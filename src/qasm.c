@@ -16,8 +16,12 @@
 #include <unistd.h>
 #include "../include/Errors.h"
 #include "../include/Definitions.h"
+#include "../include/Options.h"
+#include "../include/Tokens.h"
 
 Fname_t SrcFile;   // Source File name
+char **SrcFiles;   // Every source given, assembled one after another
+int srcCount;      // Number of sources
 
 Flag_t helpArgument;   // Is help argment specified
 Flag_t srcArgument;    // Is source file specified
@@ -26,9 +30,17 @@ extern uint8_t errcode;
 extern void PrintError(char *color, char *format, ...);
 extern void InternalError(char *format, ...);
 extern void ExternalError(char *format, ...);
+extern void FlushDiagnostics(void);
+extern void NameDiagnosticsFile(const char *path);
+
+/* Options */
+extern Options_t Options;
+extern int DecodeOption(int argc, char **argv);
+extern char **ComposeArguments(char *prog, ...);
 
 void Initialize();
 Boolean_t CheckIfSource(char *str);
+Boolean_t CheckIfTokenized(char *str);
 void DecodeArguments(int argc, char **argv);
 void StartPreprocessor(char *prepd);
 void StartAssembler(char *prepd);
@@ -54,23 +66,49 @@ int main(int argc, char **argv)
         InternalError("Error: ");
         exit(EXIT_FAILURE);
     }
+    // Sources are assembled separately only into objects, qasm-link joins them
+    if( (srcCount > 1) && (Options.format != FORMAT_OBJ) ){
+        errcode = ERR_SRCFOVERFLOW;
+        InternalError("Error: ");
+        exit(EXIT_FAILURE);
+    }
+    // Every source would list into the same files
+    if( (srcCount > 1) && (Options.listing || Options.mapfile || (Options.emits > 0)) ){
+        errcode = ERR_LSTOVERFLOW;
+        InternalError("Error: ");
+        exit(EXIT_FAILURE);
+    }
 
-    // Create the preprocessed file inside the current directory
-    Fname_t prepd;
-    strncpy(prepd, "\0", FILENAMEMAX);
-    prepd[0] = '.';
-    strcat(prepd, SrcFile);
-    size_t len = strlen(prepd);
-    prepd[len-1] = 'c';
-    prepd[len-2] = 'r';
-    prepd[len-3] = 's';
-    /*String_t cmd = strdup("touch ");
-    strcat(cmd, prepd);
-    system(cmd);
-*/
+    int src;
+    for(src=0; src<srcCount; src++){
+        NameDiagnosticsFile(SrcFiles[src]);
+        strcpy(SrcFile, SrcFiles[src]);
 
-    StartPreprocessor(prepd);    // Place constants with their values and remove comments
-    StartAssembler(prepd);       // Start pass1 and it will call pass2
+        // Tokenized by an earlier --emit-tokens, both passes read it as it is
+        if(CheckIfTokenized(SrcFile) == TRUE){
+            if(Options.listing){
+                errcode = ERR_TOKLISTING;
+                InternalError("Error: %s: ", SrcFile);
+                exit(EXIT_FAILURE);
+            }
+            StartAssembler(SrcFile);
+            continue;
+        }
+
+        // Create the preprocessed file inside the current directory
+        Fname_t prepd;
+        strncpy(prepd, "\0", FILENAMEMAX);
+        prepd[0] = '.';
+        strcat(prepd, SrcFile);
+        size_t len = strlen(prepd);
+        prepd[len-1] = 'c';
+        prepd[len-2] = 'r';
+        prepd[len-3] = 's';
+
+        StartPreprocessor(prepd);    // Place constants with their values and remove comments
+        StartAssembler(prepd);       // Start pass1 and it will call pass2
+    }
+    free(SrcFiles);
 
 
     return EXIT_SUCCESS;
@@ -83,39 +121,50 @@ void Initialize()
     
     helpArgument = NSET;
     srcArgument  = NSET;
+    SrcFiles = NULL;
+    srcCount = 0;
 
     return;
 }
 
+/* Legal arguments: --help, options and the source files */
 void DecodeArguments(int argc, char **argv)
 {
-    if(argc > 0 && argv[0]){
-        if(argc == 1){
-            // Legal arguments: --help or srcfile
-            if(strcmp(argv[0], "--help") == 0)
-                helpArgument = SET;
-            else if(CheckIfSource(argv[0]) == TRUE){
-                if(strlen(argv[0]) > FILENAMEMAX){
-                    errcode = ERR_SRCFNAMEOOB;
-                    InternalError("Error: ");
-                    exit(EXIT_FAILURE);
-                }else{
-                    strcpy(SrcFile, argv[0]);
-                    srcArgument = SET;
-                }
-            }
-
-        }else{
-            errcode = ERR_SRCFOVERFLOW;
-            InternalError("Error: ");
-            exit(EXIT_FAILURE);
-        }
-    
-    }else{
+    if(argc == 0 || !argv[0]){
         errcode = ERR_NOARGUMENT;
         InternalError("Error: ");
         exit(EXIT_FAILURE);
     }
+
+    SrcFiles = malloc(argc*sizeof(char*));
+    if(!SrcFiles){
+        ExternalError("Failed to allocate arguments: ");
+        exit(EXIT_FAILURE);
+    }
+
+    int idx;
+    for(idx=0; idx<argc; idx++){
+        if(strcmp(argv[idx], "--help") == 0){
+            helpArgument = SET;
+        }else if(argv[idx][0] == '-'){
+            int used = DecodeOption(argc-idx, argv+idx);
+            if(used == 0){
+                errcode = ERR_UNKNOWNOPT;
+                InternalError("Error: %s: ", argv[idx]);
+                exit(EXIT_FAILURE);
+            }
+            idx += used-1;
+        }else if(CheckIfSource(argv[idx]) == TRUE){
+            if(strlen(argv[idx]) > FILENAMEMAX){
+                errcode = ERR_SRCFNAMEOOB;
+                InternalError("Error: ");
+                exit(EXIT_FAILURE);
+            }else{
+                SrcFiles[srcCount++] = argv[idx];
+                srcArgument = SET;
+            }
+        }
+    }
 }
 
 //---------------------------------------------------------------------------
@@ -124,16 +173,13 @@ void StartPreprocessor(char *prepd)
 {
     int ret;
     int status;
+    FlushDiagnostics();         // The child would print them again
     pid_t pid = fork();
     if(pid < 0){
         ExternalError("Failed to start preprocessing: ");
         exit(EXIT_FAILURE);
     }else if(pid == 0){
-        char **argv = malloc(4*sizeof(char*));
-        argv[0] = strdup("qasm-prep");
-        argv[1] = strdup(SrcFile);
-        argv[2] = strdup(prepd);
-        argv[3] = NULL;
+        char **argv = ComposeArguments("qasm-prep", SrcFile, prepd, NULL);
 
         ret = execvp(argv[0], argv);
         if(ret == -1){
@@ -155,16 +201,13 @@ void StartAssembler(char *prepd)
 {
     int ret;
     int status;
+    FlushDiagnostics();         // The child would print them again
     pid_t pid = fork();
     if(pid < 0){
         ExternalError("Failed to start assembling: ");
         exit(EXIT_FAILURE);
     }else if(pid == 0){
-        char **argv = malloc(4*sizeof(char*));
-        argv[0] = strdup("qasm-pass1");
-        argv[1] = strdup(SrcFile);
-        argv[2] = strdup(prepd);
-        argv[3] = NULL;
+        char **argv = ComposeArguments("qasm-pass1", SrcFile, prepd, NULL);
 
         ret = execvp(argv[0], argv);
         if(ret == -1){
@@ -184,7 +227,22 @@ void StartAssembler(char *prepd)
 
 void PrintHelp()
 {
-    printf("Help\n");
+    printf("Usage: qasm [options] file.qsm\n");
+    printf("       qasm -f obj [options] file.qsm...    then qasm-link [-o image] file.obj...\n");
+    printf("Options:\n");
+    printf("  --help        Display this message\n");
+    printf("  --stream      Assemble with memory bounded by the symbol table, for very large sources\n");
+    printf("  -f format     Output format: bin (default), ihex, srec, mz or obj\n");
+    printf("  -l file       Write a listing of the preprocessed source with the bytes of every line\n");
+    printf("  -m file       Write the segments and the labels sorted by address, with their sizes\n");
+    printf("  --emit f=file Also write the image as bin, ihex, srec or crc32, up to 4 times\n");
+    printf("  --size-only   Print the segment sizes and the image size after pass 1, write no output\n");
+    printf("  --symbols-only  Print the label addresses as well\n");
+    printf("  --json        Print --size-only and --symbols-only as JSON\n");
+    printf("  --stats       Print the hits and misses of the encoding cache\n");
+    printf("  --emit-tokens Also write the scanned tokens to file.qsmb, assembled later without scanning\n");
+    printf("  --max-errors n  Print the first n errors of every stage and count the rest\n");
+    printf("  --diagnostics-format=json  Print diagnostics as JSON objects, one per line, without colors\n");
 }
 
 //----------------------------------------------------------------------------
@@ -199,4 +257,16 @@ Boolean_t CheckIfSource(char *str)
         else
             return FALSE;
     }
-}
\ No newline at end of file
+}
+
+//----------------------------------------------------------------------------
+
+Boolean_t CheckIfTokenized(char *str)
+{
+    size_t len = strlen(str);
+    size_t ext = strlen(TOKFILE_EXT);
+    if( (len > ext) && (strcmp(str+len-ext, TOKFILE_EXT) == 0) )
+        return TRUE;
+    else
+        return FALSE;
+}